@@ -0,0 +1,773 @@
+/*
+ *   Ce fichier fait parti d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux 1
+ *
+ *   Copyright (C) 2014 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "arbre_b.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Taille d'une ligne de cache, en octets. */
+#define LIGNE_CACHE 64
+
+/*
+ * Nombre maximal d'éléments d'une feuille et de séparateurs d'un noeud
+ * interne. Avec des pointeurs de 8 octets, une feuille comme un noeud
+ * interne occupent alors exactement 4 lignes de cache.
+ */
+#define MAX_FEUILLE 29
+#define MAX_INTERNE 15
+
+/* Tous les noeuds, sauf la racine, sont au moins à moitié pleins. */
+#define MIN_FEUILLE ( MAX_FEUILLE / 2 )
+#define MIN_INTERNE ( MAX_INTERNE / 2 )
+
+typedef struct _Arbre_b_feuille {
+	int nb;
+	struct _Arbre_b_feuille * precedente;
+	struct _Arbre_b_feuille * suivante;
+	void * elements[MAX_FEUILLE];
+} Feuille;
+
+/*
+ * Un noeud interne de 'nb' séparateurs a 'nb'+1 fils. Le séparateur i est le
+ * plus petit élément du sous-arbre enfants[i+1] : le fils i contient donc les
+ * éléments compris entre les séparateurs i-1 (inclus) et i (exclus).
+ */
+typedef struct {
+	long nb;
+	void * separateurs[MAX_INTERNE];
+	void * enfants[MAX_INTERNE + 1];
+} Interne;
+
+/*
+ * 'hauteur' est le nombre de niveaux de noeuds internes : la racine est une
+ * feuille si 'hauteur' vaut 0.
+ */
+struct _Arbre_b {
+	void * racine;
+	int hauteur;
+	size_t nb;
+	int (*comparer)( const void* element1, const void* element2, void* param );
+	void * param;
+};
+
+void* allouer_noeud_arbre_b( size_t taille ){
+	// Les noeuds sont alignés sur les lignes de cache.
+	void* noeud = aligned_alloc( LIGNE_CACHE, taille );
+	if( ! noeud ){
+		ERREUR( "Espace insuffisant" );
+	}
+	return noeud;
+}
+
+Feuille* creer_feuille_arbre_b(){
+	Feuille* feuille = allouer_noeud_arbre_b( sizeof(Feuille) );
+	feuille->nb = 0;
+	feuille->precedente = NULL;
+	feuille->suivante = NULL;
+	return feuille;
+}
+
+Interne* creer_interne_arbre_b(){
+	Interne* noeud = allouer_noeud_arbre_b( sizeof(Interne) );
+	noeud->nb = 0;
+	return noeud;
+}
+
+int comparer_arbre_b(
+	const Arbre_b* arbre, const void* element1, const void* element2
+){
+	return arbre->comparer( element1, element2, arbre->param );
+}
+
+/*
+ * Renvoie l'indice du fils du noeud dans lequel se trouve (ou devrait se
+ * trouver) l'élément.
+ */
+int indice_fils_arbre_b(
+	const Arbre_b* arbre, const Interne* noeud, const void* element
+){
+	int debut = 0;
+	int fin = noeud->nb;
+	while( debut < fin ){
+		int milieu = ( debut + fin ) / 2;
+		if( comparer_arbre_b( arbre, element, noeud->separateurs[milieu] ) < 0 ){
+			fin = milieu;
+		}else{
+			debut = milieu + 1;
+		}
+	}
+	return debut;
+}
+
+/*
+ * Renvoie l'indice du premier élément de la feuille supérieur ou égal à
+ * l'élément, et met '*trouve' à 1 si cet élément est égal à l'élément.
+ */
+int indice_feuille_arbre_b(
+	const Arbre_b* arbre, const Feuille* feuille, const void* element,
+	int* trouve
+){
+	int debut = 0;
+	int fin = feuille->nb;
+	*trouve = 0;
+	while( debut < fin ){
+		int milieu = ( debut + fin ) / 2;
+		int cmp = comparer_arbre_b( arbre, element, feuille->elements[milieu] );
+		if( cmp == 0 ){
+			*trouve = 1;
+			return milieu;
+		}
+		if( cmp < 0 ){
+			fin = milieu;
+		}else{
+			debut = milieu + 1;
+		}
+	}
+	return debut;
+}
+
+Feuille* chercher_feuille_arbre_b( const Arbre_b* arbre, const void* element ){
+	void* noeud = arbre->racine;
+	int hauteur;
+	for( hauteur = arbre->hauteur; hauteur > 0; hauteur-- ){
+		Interne* interne = (Interne*) noeud;
+		noeud = interne->enfants[ indice_fils_arbre_b( arbre, interne, element ) ];
+	}
+	return (Feuille*) noeud;
+}
+
+void* minimum_arbre_b( void* noeud, int hauteur ){
+	for( ; hauteur > 0; hauteur-- ){
+		noeud = ( (Interne*) noeud )->enfants[0];
+	}
+	return ( (Feuille*) noeud )->elements[0];
+}
+
+Arbre_b* creer_arbre_b(
+	int (*comparer)( const void* element1, const void* element2, void* param ),
+	void* param
+){
+	Arbre_b* arbre = xmalloc( sizeof(Arbre_b) );
+	arbre->racine = NULL;
+	arbre->hauteur = 0;
+	arbre->nb = 0;
+	arbre->comparer = comparer;
+	arbre->param = param;
+	return arbre;
+}
+
+void liberer_noeud_arbre_b( void* noeud, int hauteur ){
+	if( hauteur > 0 ){
+		Interne* interne = (Interne*) noeud;
+		int i;
+		for( i=0; i<=interne->nb; i++ ){
+			liberer_noeud_arbre_b( interne->enfants[i], hauteur-1 );
+		}
+	}
+	xfree( noeud );
+}
+
+void liberer_arbre_b(
+	Arbre_b* arbre, void (*supprimer)( void* element, void* param )
+){
+	if( arbre->racine ){
+		if( supprimer ){
+			Arbre_b_parcours parcours;
+			void* element;
+			for(
+				element = premier_arbre_b( &parcours, arbre );
+				element;
+				element = suivant_arbre_b( &parcours )
+			){
+				supprimer( element, arbre->param );
+			}
+		}
+		liberer_noeud_arbre_b( arbre->racine, arbre->hauteur );
+	}
+	xfree( arbre );
+}
+
+size_t taille_arbre_b( const Arbre_b* arbre ){
+	return arbre->nb;
+}
+
+size_t memoire_noeud_arbre_b( const void* noeud, int hauteur ){
+	if( hauteur == 0 ){
+		return sizeof( Feuille );
+	}
+	const Interne* interne = (const Interne*) noeud;
+	size_t res = sizeof( Interne );
+	int i;
+	for( i=0; i<=interne->nb; i++ ){
+		res += memoire_noeud_arbre_b( interne->enfants[i], hauteur-1 );
+	}
+	return res;
+}
+
+size_t memoire_arbre_b( const Arbre_b* arbre ){
+	size_t res = sizeof( Arbre_b );
+	if( arbre->racine ){
+		res += memoire_noeud_arbre_b( arbre->racine, arbre->hauteur );
+	}
+	return res;
+}
+
+void* chercher_arbre_b( const Arbre_b* arbre, const void* element ){
+	if( ! arbre->racine ) return NULL;
+	Feuille* feuille = chercher_feuille_arbre_b( arbre, element );
+	int trouve;
+	int i = indice_feuille_arbre_b( arbre, feuille, element, &trouve );
+	return trouve ? feuille->elements[i] : NULL;
+}
+
+/*
+ * Insère l'élément à la position i d'une feuille pleine, en coupant la
+ * feuille en deux. La nouvelle feuille (à droite) est renvoyée dans
+ * '*nouveau' et son premier élément dans '*separateur'.
+ */
+void** couper_feuille_arbre_b(
+	Feuille* feuille, int i, void* element, void** nouveau, void** separateur
+){
+	void* tous[MAX_FEUILLE + 1];
+	memcpy( tous, feuille->elements, i * sizeof(void*) );
+	tous[i] = element;
+	memcpy(
+		tous + i + 1, feuille->elements + i, ( MAX_FEUILLE - i ) * sizeof(void*)
+	);
+
+	int gauche = ( MAX_FEUILLE + 1 ) / 2;
+	Feuille* droite = creer_feuille_arbre_b();
+	memcpy( feuille->elements, tous, gauche * sizeof(void*) );
+	memcpy(
+		droite->elements, tous + gauche,
+		( MAX_FEUILLE + 1 - gauche ) * sizeof(void*)
+	);
+	feuille->nb = gauche;
+	droite->nb = MAX_FEUILLE + 1 - gauche;
+
+	droite->precedente = feuille;
+	droite->suivante = feuille->suivante;
+	if( feuille->suivante ){
+		feuille->suivante->precedente = droite;
+	}
+	feuille->suivante = droite;
+
+	*nouveau = droite;
+	*separateur = droite->elements[0];
+	return ( i < gauche ) ? &feuille->elements[i] : &droite->elements[i-gauche];
+}
+
+/*
+ * Insère le séparateur et le fils 'fils' à droite du fils i d'un noeud
+ * interne plein, en coupant le noeud en deux. Le nouveau noeud (à droite)
+ * est renvoyé dans '*nouveau' et le séparateur qui doit remonter dans
+ * '*separateur'.
+ */
+void couper_interne_arbre_b(
+	Interne* noeud, int i, void* separateur_fils, void* fils,
+	void** nouveau, void** separateur
+){
+	void* separateurs[MAX_INTERNE + 1];
+	void* enfants[MAX_INTERNE + 2];
+	memcpy( separateurs, noeud->separateurs, i * sizeof(void*) );
+	separateurs[i] = separateur_fils;
+	memcpy(
+		separateurs + i + 1, noeud->separateurs + i,
+		( MAX_INTERNE - i ) * sizeof(void*)
+	);
+	memcpy( enfants, noeud->enfants, ( i + 1 ) * sizeof(void*) );
+	enfants[i+1] = fils;
+	memcpy(
+		enfants + i + 2, noeud->enfants + i + 1,
+		( MAX_INTERNE - i ) * sizeof(void*)
+	);
+
+	int gauche = ( MAX_INTERNE + 1 ) / 2;
+	Interne* droite = creer_interne_arbre_b();
+	memcpy( noeud->separateurs, separateurs, gauche * sizeof(void*) );
+	memcpy( noeud->enfants, enfants, ( gauche + 1 ) * sizeof(void*) );
+	noeud->nb = gauche;
+
+	droite->nb = MAX_INTERNE - gauche;
+	memcpy(
+		droite->separateurs, separateurs + gauche + 1,
+		droite->nb * sizeof(void*)
+	);
+	memcpy(
+		droite->enfants, enfants + gauche + 1,
+		( droite->nb + 1 ) * sizeof(void*)
+	);
+
+	*nouveau = droite;
+	*separateur = separateurs[gauche];
+}
+
+/*
+ * Cherche l'élément égal à 'modele' dans le sous-arbre 'noeud' et, s'il n'y
+ * est pas, insère l'élément creer( modele, data ) (ou 'modele' lui-même si
+ * 'creer' vaut NULL). Si le noeud doit alors être coupé en deux, sa moitié
+ * droite est renvoyée dans '*nouveau' et son plus petit élément dans 
+ * '*separateur' ; sinon, '*nouveau' vaut NULL.
+ * '*insere' est mis à 0 si un élément égal était déjà présent.
+ * Renvoie l'adresse de la case de l'élément.
+ */
+void** sonder_noeud_arbre_b(
+	Arbre_b* arbre, void* noeud, int hauteur, const void* modele,
+	void* (*creer)( const void* modele, void* data ), void* data,
+	void** nouveau, void** separateur, int* insere
+){
+	*nouveau = NULL;
+	if( hauteur == 0 ){
+		Feuille* feuille = (Feuille*) noeud;
+		int trouve;
+		int i = indice_feuille_arbre_b( arbre, feuille, modele, &trouve );
+		if( trouve ){
+			*insere = 0;
+			return &feuille->elements[i];
+		}
+		*insere = 1;
+		void* element = creer ? creer( modele, data ) : (void*) modele;
+		if( feuille->nb == MAX_FEUILLE ){
+			return couper_feuille_arbre_b(
+				feuille, i, element, nouveau, separateur
+			);
+		}
+		memmove(
+			feuille->elements + i + 1, feuille->elements + i,
+			( feuille->nb - i ) * sizeof(void*)
+		);
+		feuille->elements[i] = element;
+		feuille->nb++;
+		return &feuille->elements[i];
+	}
+
+	Interne* interne = (Interne*) noeud;
+	int i = indice_fils_arbre_b( arbre, interne, modele );
+	void* fils;
+	void* separateur_fils;
+	void** res = sonder_noeud_arbre_b(
+		arbre, interne->enfants[i], hauteur-1, modele, creer, data,
+		&fils, &separateur_fils, insere
+	);
+	if( ! fils ){
+		return res;
+	}
+	if( interne->nb == MAX_INTERNE ){
+		couper_interne_arbre_b(
+			interne, i, separateur_fils, fils, nouveau, separateur
+		);
+		return res;
+	}
+	memmove(
+		interne->separateurs + i + 1, interne->separateurs + i,
+		( interne->nb - i ) * sizeof(void*)
+	);
+	memmove(
+		interne->enfants + i + 2, interne->enfants + i + 1,
+		( interne->nb - i ) * sizeof(void*)
+	);
+	interne->separateurs[i] = separateur_fils;
+	interne->enfants[i+1] = fils;
+	interne->nb++;
+	return res;
+}
+
+void** sonder_arbre_b(
+	Arbre_b* arbre, const void* modele,
+	void* (*creer)( const void* modele, void* data ), void* data,
+	int* insere
+){
+	if( ! arbre->racine ){
+		arbre->racine = creer_feuille_arbre_b();
+		arbre->hauteur = 0;
+	}
+	void* nouveau;
+	void* separateur;
+	void** res = sonder_noeud_arbre_b(
+		arbre, arbre->racine, arbre->hauteur, modele, creer, data,
+		&nouveau, &separateur, insere
+	);
+	if( nouveau ){
+		Interne* racine = creer_interne_arbre_b();
+		racine->nb = 1;
+		racine->separateurs[0] = separateur;
+		racine->enfants[0] = arbre->racine;
+		racine->enfants[1] = nouveau;
+		arbre->racine = racine;
+		arbre->hauteur++;
+	}
+	if( *insere ){
+		arbre->nb++;
+	}
+	return res;
+}
+
+void** inserer_arbre_b( Arbre_b* arbre, void* element ){
+	int insere;
+	return sonder_arbre_b( arbre, element, NULL, NULL, &insere );
+}
+
+/*
+ * Retire du noeud 'parent' le séparateur j et le fils j+1.
+ */
+void retirer_fils_arbre_b( Interne* parent, int j ){
+	memmove(
+		parent->separateurs + j, parent->separateurs + j + 1,
+		( parent->nb - j - 1 ) * sizeof(void*)
+	);
+	memmove(
+		parent->enfants + j + 1, parent->enfants + j + 2,
+		( parent->nb - j - 1 ) * sizeof(void*)
+	);
+	parent->nb--;
+}
+
+/*
+ * Fusionne les fils j et j+1 du noeud 'parent', qui sont de hauteur
+ * 'hauteur'.
+ */
+void fusionner_fils_arbre_b( Interne* parent, int j, int hauteur ){
+	if( hauteur == 0 ){
+		Feuille* gauche = (Feuille*) parent->enfants[j];
+		Feuille* droite = (Feuille*) parent->enfants[j+1];
+		memcpy(
+			gauche->elements + gauche->nb, droite->elements,
+			droite->nb * sizeof(void*)
+		);
+		gauche->nb += droite->nb;
+		gauche->suivante = droite->suivante;
+		if( droite->suivante ){
+			droite->suivante->precedente = gauche;
+		}
+		xfree( droite );
+	}else{
+		Interne* gauche = (Interne*) parent->enfants[j];
+		Interne* droite = (Interne*) parent->enfants[j+1];
+		gauche->separateurs[gauche->nb] = parent->separateurs[j];
+		memcpy(
+			gauche->separateurs + gauche->nb + 1, droite->separateurs,
+			droite->nb * sizeof(void*)
+		);
+		memcpy(
+			gauche->enfants + gauche->nb + 1, droite->enfants,
+			( droite->nb + 1 ) * sizeof(void*)
+		);
+		gauche->nb += 1 + droite->nb;
+		xfree( droite );
+	}
+	retirer_fils_arbre_b( parent, j );
+}
+
+/*
+ * Le fils i du noeud 'parent', de hauteur 'hauteur', contient un élément de
+ * moins que le minimum : il emprunte un élément à un de ses frères ou, si
+ * ceux-ci sont eux-mêmes au minimum, il est fusionné avec l'un d'eux.
+ */
+void reequilibrer_fils_arbre_b( Interne* parent, int i, int hauteur ){
+	if( hauteur == 0 ){
+		Feuille* fils = (Feuille*) parent->enfants[i];
+		Feuille* gauche = ( i > 0 ) ? parent->enfants[i-1] : NULL;
+		Feuille* droite = ( i < parent->nb ) ? parent->enfants[i+1] : NULL;
+		if( gauche && gauche->nb > MIN_FEUILLE ){
+			memmove(
+				fils->elements + 1, fils->elements, fils->nb * sizeof(void*)
+			);
+			fils->elements[0] = gauche->elements[--gauche->nb];
+			fils->nb++;
+			parent->separateurs[i-1] = fils->elements[0];
+		}else if( droite && droite->nb > MIN_FEUILLE ){
+			fils->elements[fils->nb++] = droite->elements[0];
+			memmove(
+				droite->elements, droite->elements + 1,
+				--droite->nb * sizeof(void*)
+			);
+			parent->separateurs[i] = droite->elements[0];
+		}else if( gauche ){
+			fusionner_fils_arbre_b( parent, i-1, hauteur );
+		}else{
+			fusionner_fils_arbre_b( parent, i, hauteur );
+		}
+		return;
+	}
+
+	Interne* fils = (Interne*) parent->enfants[i];
+	Interne* gauche = ( i > 0 ) ? parent->enfants[i-1] : NULL;
+	Interne* droite = ( i < parent->nb ) ? parent->enfants[i+1] : NULL;
+	if( gauche && gauche->nb > MIN_INTERNE ){
+		memmove(
+			fils->separateurs + 1, fils->separateurs, fils->nb * sizeof(void*)
+		);
+		memmove(
+			fils->enfants + 1, fils->enfants, ( fils->nb + 1 ) * sizeof(void*)
+		);
+		fils->separateurs[0] = parent->separateurs[i-1];
+		fils->enfants[0] = gauche->enfants[gauche->nb];
+		fils->nb++;
+		parent->separateurs[i-1] = gauche->separateurs[gauche->nb - 1];
+		gauche->nb--;
+	}else if( droite && droite->nb > MIN_INTERNE ){
+		fils->separateurs[fils->nb] = parent->separateurs[i];
+		fils->enfants[fils->nb + 1] = droite->enfants[0];
+		fils->nb++;
+		parent->separateurs[i] = droite->separateurs[0];
+		memmove(
+			droite->separateurs, droite->separateurs + 1,
+			( droite->nb - 1 ) * sizeof(void*)
+		);
+		memmove(
+			droite->enfants, droite->enfants + 1, droite->nb * sizeof(void*)
+		);
+		droite->nb--;
+	}else if( gauche ){
+		fusionner_fils_arbre_b( parent, i-1, hauteur );
+	}else{
+		fusionner_fils_arbre_b( parent, i, hauteur );
+	}
+}
+
+/*
+ * Retire l'élément du sous-arbre 'noeud' et le renvoie, ou renvoie NULL si
+ * l'élément n'y est pas. Le noeud peut alors contenir un élément de moins que
+ * le minimum : c'est à son parent de le rééquilibrer.
+ */
+void* retirer_noeud_arbre_b(
+	Arbre_b* arbre, void* noeud, int hauteur, const void* element
+){
+	if( hauteur == 0 ){
+		Feuille* feuille = (Feuille*) noeud;
+		int trouve;
+		int i = indice_feuille_arbre_b( arbre, feuille, element, &trouve );
+		if( ! trouve ) return NULL;
+		void* res = feuille->elements[i];
+		memmove(
+			feuille->elements + i, feuille->elements + i + 1,
+			( feuille->nb - i - 1 ) * sizeof(void*)
+		);
+		feuille->nb--;
+		return res;
+	}
+
+	Interne* interne = (Interne*) noeud;
+	int i = indice_fils_arbre_b( arbre, interne, element );
+	void* res = retirer_noeud_arbre_b(
+		arbre, interne->enfants[i], hauteur-1, element
+	);
+	if( ! res ) return NULL;
+
+	// L'élément retiré était peut-être le séparateur du fils.
+	if( i > 0 ){
+		interne->separateurs[i-1] = minimum_arbre_b(
+			interne->enfants[i], hauteur-1
+		);
+	}
+	int nb = ( hauteur == 1 ) ?
+		( (Feuille*) interne->enfants[i] )->nb :
+		( (Interne*) interne->enfants[i] )->nb;
+	int min = ( hauteur == 1 ) ? MIN_FEUILLE : MIN_INTERNE;
+	if( nb < min ){
+		reequilibrer_fils_arbre_b( interne, i, hauteur-1 );
+	}
+	return res;
+}
+
+void* retirer_arbre_b( Arbre_b* arbre, const void* element ){
+	if( ! arbre->racine ) return NULL;
+	void* res = retirer_noeud_arbre_b(
+		arbre, arbre->racine, arbre->hauteur, element
+	);
+	if( ! res ) return NULL;
+	arbre->nb--;
+
+	if( arbre->hauteur > 0 ){
+		Interne* racine = (Interne*) arbre->racine;
+		if( racine->nb == 0 ){
+			arbre->racine = racine->enfants[0];
+			arbre->hauteur--;
+			xfree( racine );
+		}
+	}else if( ( (Feuille*) arbre->racine )->nb == 0 ){
+		xfree( arbre->racine );
+		arbre->racine = NULL;
+	}
+	return res;
+}
+
+void construire_arbre_b( Arbre_b* arbre, void** elements, size_t nb ){
+	if( arbre->racine ){
+		ERREUR( "L'arbre doit être vide" );
+	}
+	if( nb == 0 ) return;
+
+	// Les éléments sont répartis équitablement entre le moins de feuilles
+	// possible, puis les feuilles entre le moins de noeuds possible, etc.
+	// Chaque noeud est ainsi au moins à moitié plein.
+	size_t nb_noeuds = ( nb + MAX_FEUILLE - 1 ) / MAX_FEUILLE;
+	void** noeuds = xmalloc( nb_noeuds * sizeof(void*) );
+	void** minimums = xmalloc( nb_noeuds * sizeof(void*) );
+	Feuille* precedente = NULL;
+	size_t i, k = 0;
+	for( i=0; i<nb_noeuds; i++ ){
+		size_t taille = nb / nb_noeuds + ( i < nb % nb_noeuds );
+		Feuille* feuille = creer_feuille_arbre_b();
+		memcpy( feuille->elements, elements + k, taille * sizeof(void*) );
+		feuille->nb = taille;
+		feuille->precedente = precedente;
+		if( precedente ){
+			precedente->suivante = feuille;
+		}
+		precedente = feuille;
+		noeuds[i] = feuille;
+		minimums[i] = elements[k];
+		k += taille;
+	}
+
+	int hauteur = 0;
+	while( nb_noeuds > 1 ){
+		size_t nb_parents = ( nb_noeuds + MAX_INTERNE ) / ( MAX_INTERNE + 1 );
+		size_t j = 0;
+		// Le niveau supérieur est construit en place dans 'noeuds' : le
+		// parent i est écrit après la lecture de ses fils, d'indices >= i.
+		for( i=0; i<nb_parents; i++ ){
+			size_t nb_fils = nb_noeuds / nb_parents + ( i < nb_noeuds % nb_parents );
+			Interne* parent = creer_interne_arbre_b();
+			size_t f;
+			for( f=0; f<nb_fils; f++ ){
+				parent->enfants[f] = noeuds[j+f];
+				if( f > 0 ){
+					parent->separateurs[f-1] = minimums[j+f];
+				}
+			}
+			parent->nb = nb_fils - 1;
+			minimums[i] = minimums[j];
+			noeuds[i] = parent;
+			j += nb_fils;
+		}
+		nb_noeuds = nb_parents;
+		hauteur++;
+	}
+
+	arbre->racine = noeuds[0];
+	arbre->hauteur = hauteur;
+	arbre->nb = nb;
+	xfree( noeuds );
+	xfree( minimums );
+}
+
+void* courant_arbre_b( const Arbre_b_parcours* parcours ){
+	if( ! parcours->feuille ) return NULL;
+	return parcours->feuille->elements[ parcours->indice ];
+}
+
+void* premier_arbre_b( Arbre_b_parcours* parcours, const Arbre_b* arbre ){
+	parcours->arbre = arbre;
+	parcours->feuille = NULL;
+	if( ! arbre->racine ) return NULL;
+	void* noeud = arbre->racine;
+	int hauteur;
+	for( hauteur = arbre->hauteur; hauteur > 0; hauteur-- ){
+		noeud = ( (Interne*) noeud )->enfants[0];
+	}
+	parcours->feuille = (Feuille*) noeud;
+	parcours->indice = 0;
+	return courant_arbre_b( parcours );
+}
+
+void* dernier_arbre_b( Arbre_b_parcours* parcours, const Arbre_b* arbre ){
+	parcours->arbre = arbre;
+	parcours->feuille = NULL;
+	if( ! arbre->racine ) return NULL;
+	void* noeud = arbre->racine;
+	int hauteur;
+	for( hauteur = arbre->hauteur; hauteur > 0; hauteur-- ){
+		Interne* interne = (Interne*) noeud;
+		noeud = interne->enfants[ interne->nb ];
+	}
+	parcours->feuille = (Feuille*) noeud;
+	parcours->indice = parcours->feuille->nb - 1;
+	return courant_arbre_b( parcours );
+}
+
+void* placer_arbre_b(
+	Arbre_b_parcours* parcours, const Arbre_b* arbre, const void* element
+){
+	parcours->arbre = arbre;
+	parcours->feuille = NULL;
+	if( ! arbre->racine ) return NULL;
+	Feuille* feuille = chercher_feuille_arbre_b( arbre, element );
+	int trouve;
+	int i = indice_feuille_arbre_b( arbre, feuille, element, &trouve );
+	if( trouve ){
+		parcours->feuille = feuille;
+		parcours->indice = i;
+	}
+	return courant_arbre_b( parcours );
+}
+
+void* placer_superieur_arbre_b(
+	Arbre_b_parcours* parcours, const Arbre_b* arbre, const void* element,
+	int strictement
+){
+	parcours->arbre = arbre;
+	parcours->feuille = NULL;
+	if( ! arbre->racine ) return NULL;
+	Feuille* feuille = chercher_feuille_arbre_b( arbre, element );
+	int trouve;
+	int i = indice_feuille_arbre_b( arbre, feuille, element, &trouve );
+	if( trouve && strictement ){
+		i++;
+	}
+	// Tous les éléments de la feuille sont plus petits : le premier élément
+	// de la feuille suivante convient.
+	if( i == feuille->nb ){
+		feuille = feuille->suivante;
+		i = 0;
+	}
+	parcours->feuille = feuille;
+	parcours->indice = i;
+	return courant_arbre_b( parcours );
+}
+
+void* suivant_arbre_b( Arbre_b_parcours* parcours ){
+	if( ! parcours->feuille ){
+		return premier_arbre_b( parcours, parcours->arbre );
+	}
+	parcours->indice++;
+	if( parcours->indice == parcours->feuille->nb ){
+		parcours->feuille = parcours->feuille->suivante;
+		parcours->indice = 0;
+	}
+	return courant_arbre_b( parcours );
+}
+
+void* precedent_arbre_b( Arbre_b_parcours* parcours ){
+	if( ! parcours->feuille ){
+		return dernier_arbre_b( parcours, parcours->arbre );
+	}
+	if( parcours->indice == 0 ){
+		parcours->feuille = parcours->feuille->precedente;
+		if( ! parcours->feuille ) return NULL;
+		parcours->indice = parcours->feuille->nb;
+	}
+	parcours->indice--;
+	return courant_arbre_b( parcours );
+}
@@ -0,0 +1,158 @@
+/*
+ *   Ce fichier fait parti d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux 1
+ *
+ *   Copyright (C) 2014 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef __ARBRE_B_H__
+#define __ARBRE_B_H__
+
+#include <stddef.h>
+
+/*
+ * Arbre B+ contenant des éléments ordonnés (des pointeurs, comme les arbres
+ * AVL de avl.h).
+ *
+ * Tous les éléments sont rangés dans les feuilles, par paquets contigus, et
+ * les feuilles sont chaînées dans les deux sens. Les noeuds internes ne
+ * contiennent que des séparateurs (des pointeurs vers le plus petit élément
+ * du sous-arbre situé à leur droite) et font une taille multiple d'une
+ * ligne de cache : un arbre de n éléments n'a que de l'ordre de log_16( n )
+ * niveaux, et un parcours complet lit les feuilles les unes après les autres.
+ *
+ * L'arbre ne gère pas la mémoire de ses éléments.
+ */
+typedef struct _Arbre_b Arbre_b;
+
+struct _Arbre_b_feuille;
+
+/*
+ * Position dans un arbre B+ : une feuille et un indice dans cette feuille.
+ * Une position dont la feuille vaut NULL est vide.
+ *
+ * Une position n'est plus valide dès que l'arbre est modifié.
+ */
+typedef struct {
+	const Arbre_b * arbre;
+	struct _Arbre_b_feuille * feuille;
+	int indice;
+} Arbre_b_parcours;
+
+/*
+ * Crée un arbre B+ vide. Les éléments sont comparés avec la fonction
+ * 'comparer', à laquelle est passé le paramètre 'param'.
+ */
+Arbre_b* creer_arbre_b(
+	int (*comparer)( const void* element1, const void* element2, void* param ),
+	void* param
+);
+
+/*
+ * Libère l'arbre. Si 'supprimer' n'est pas NULL, la fonction est appliquée à
+ * chaque élément, dans l'ordre croissant.
+ */
+void liberer_arbre_b(
+	Arbre_b* arbre, void (*supprimer)( void* element, void* param )
+);
+
+/*
+ * Renvoie le nombre d'éléments de l'arbre.
+ */
+size_t taille_arbre_b( const Arbre_b* arbre );
+
+/*
+ * Renvoie la mémoire occupée par l'arbre et ses noeuds (mais pas par ses 
+ * éléments), en octets. Les noeuds sont parcourus : la fonction s'exécute en
+ * temps linéaire.
+ */
+size_t memoire_arbre_b( const Arbre_b* arbre );
+
+/*
+ * Insère l'élément dans l'arbre et renvoie l'adresse de la case où il est
+ * rangé. Si un élément égal se trouve déjà dans l'arbre, l'arbre n'est pas
+ * modifié et c'est l'adresse de la case de cet élément qui est renvoyée.
+ *
+ * L'adresse renvoyée n'est plus valide dès que l'arbre est modifié.
+ */
+void** inserer_arbre_b( Arbre_b* arbre, void* element );
+
+/*
+ * Cherche l'élément égal à 'modele' et renvoie l'adresse de sa case. S'il
+ * n'y en a pas, l'élément creer( modele, data ) est inséré (ou 'modele'
+ * lui-même si 'creer' vaut NULL) : l'élément n'est ainsi créé qu'une fois sa 
+ * place trouvée, en une seule descente dans l'arbre.
+ * '*insere' vaut ensuite 1 si un élément a été inséré, 0 sinon.
+ *
+ * L'élément rangé dans une case ne doit pas être remplacé : il peut aussi 
+ * servir de séparateur dans un noeud interne.
+ */
+void** sonder_arbre_b(
+	Arbre_b* arbre, const void* modele,
+	void* (*creer)( const void* modele, void* data ), void* data,
+	int* insere
+);
+
+/*
+ * Retire de l'arbre l'élément égal à celui passé en paramètre et le renvoie,
+ * ou renvoie NULL si un tel élément n'existe pas.
+ */
+void* retirer_arbre_b( Arbre_b* arbre, const void* element );
+
+/*
+ * Renvoie l'élément de l'arbre égal à celui passé en paramètre, ou NULL si
+ * un tel élément n'existe pas.
+ */
+void* chercher_arbre_b( const Arbre_b* arbre, const void* element );
+
+/*
+ * Remplit l'arbre, qui doit être vide, avec les 'nb' éléments de 'elements',
+ * qui doivent être triés par ordre strictement croissant. L'arbre est
+ * construit en temps linéaire, avec des noeuds presque pleins.
+ */
+void construire_arbre_b( Arbre_b* arbre, void** elements, size_t nb );
+
+/*
+ * Les fonctions de parcours suivantes placent la position sur un élément
+ * et renvoient cet élément, ou rendent la position vide et renvoient NULL.
+ *
+ * Comme pour les parcours de avl.h, l'élément suivant (resp. précédent)
+ * d'une position vide est le premier (resp. dernier) élément de l'arbre.
+ *
+ * placer_superieur_arbre_b() place la position sur le plus petit élément
+ * supérieur ou égal (strictement supérieur si 'strictement' est vrai) à
+ * l'élément passé en paramètre.
+ */
+void* premier_arbre_b( Arbre_b_parcours* parcours, const Arbre_b* arbre );
+void* dernier_arbre_b( Arbre_b_parcours* parcours, const Arbre_b* arbre );
+void* placer_arbre_b(
+	Arbre_b_parcours* parcours, const Arbre_b* arbre, const void* element
+);
+void* placer_superieur_arbre_b(
+	Arbre_b_parcours* parcours, const Arbre_b* arbre, const void* element,
+	int strictement
+);
+void* suivant_arbre_b( Arbre_b_parcours* parcours );
+void* precedent_arbre_b( Arbre_b_parcours* parcours );
+
+/*
+ * Renvoie l'élément de la position, ou NULL si la position est vide.
+ */
+void* courant_arbre_b( const Arbre_b_parcours* parcours );
+
+#endif
@@ -27,6 +27,8 @@
 #include "table.h"
 #include "ensemble.h"
 #include "outils.h"
+#include "conteneurs_types.h"
+#include "fifo.h"
 
 #include <search.h>
 #include <stdio.h>
@@ -39,17 +41,78 @@
 struct _Automate {
 	Ensemble * vide;
 	Ensemble * etats;
+	Table* rangs;
 	Ensemble * alphabet;
 	Table* transitions;
+	Table* lignes;
+	Table* lignes_inverses;
+	Table* epsilon;
+	Table* clotures;
+	size_t generation_epsilon;
+	size_t generation_clotures;
 	Ensemble * initiaux;
 	Ensemble * finaux;
 };
 
+/*
+ * Clé de la table 'transitions'.
+ *
+ * Cette table n'est pas un conteneur typé (voir conteneurs_types.h) : ceux-ci
+ * rangent leurs éléments triés dans un tableau, et l'ajout d'une transition 
+ * dans le désordre y coûterait un décalage de toute la fin du tableau, 
+ * soit un temps quadratique pour construire un grand automate. Les 
+ * recherches fréquentes par origine et par lettre passent de toute façon par
+ * les lignes de transitions, qui sont des tables typées.
+ */
 typedef struct _Cle {
 	int origine;
 	int lettre;
 } Cle;
 
+/*
+ * Les transitions sortantes d'un état, regroupées par lettre.
+ *
+ * Les lettres (cles[0], ..., cles[nb-1]) sont triées par ordre croissant et 
+ * valeurs[i] est l'ensemble des états atteints depuis l'état en lisant 
+ * cles[i]. Ces ensembles sont ceux de la table des transitions de 
+ * l'automate : ils ne sont pas recopiés.
+ *
+ * La table 'lignes' de l'automate (une table de hachage) associe à chaque 
+ * état sa ligne, ce qui permet de trouver les transitions d'un état sans 
+ * parcourir l'arbre de toutes les transitions.
+ *
+ * Si l'index des prédécesseurs est actif (voir indexer_predecesseurs()), la
+ * table 'lignes_inverses' associe de même à chaque état la ligne des 
+ * transitions qui y arrivent : valeurs[i] est alors l'ensemble des origines 
+ * des transitions étiquetées par cles[i]. Ces ensembles appartiennent à la 
+ * ligne. Sinon, 'lignes_inverses' vaut NULL.
+ */
+DEFINIR_TABLE( Ligne_transitions, char, Ensemble *, COMPARER_VALEURS )
+
+/*
+ * Les ε-transitions ne sont pas rangées avec les transitions étiquetées par 
+ * une lettre : la table 'epsilon' (un arbre, pour parcourir les 
+ * ε-transitions dans l'ordre) associe à chaque état l'ensemble des fins de
+ * ses ε-transitions, et l'alphabet ne contient pas ε.
+ *
+ * La table 'clotures' (une table de hachage) garde les ε-clôtures déjà 
+ * calculées par epsilon_cloture(). Chaque ajout d'une ε-transition augmente
+ * 'generation_epsilon' ; les clôtures, calculées à la génération 
+ * 'generation_clotures', ne sont vidées qu'au prochain appel de 
+ * epsilon_cloture() qui constate la différence. Ajouter n ε-transitions 
+ * coûte ainsi O(n), et non n vidages du cache.
+ */
+
+/*
+ * La table 'rangs' (une table de hachage) associe à chaque état son rang 
+ * dans l'ordre d'ajout des états (voir ranger_etat()).
+ */
+
+/*
+ * Ensemble d'états utilisé pour les calculs internes à ce fichier.
+ */
+DEFINIR_ENSEMBLE( Ensemble_etats, int, COMPARER_VALEURS )
+
 
 /******
  Code Utilitaire
@@ -74,6 +137,15 @@ typedef struct _AutomateTransition
 	int destination;
 } AutomateTransition;
 
+/**
+ * \brief Type regroupant un automate et un ensemble d'états
+ */
+typedef struct _AutomateEnsemble
+{
+	Automate* automate;
+	const Ensemble* ensemble;
+} AutomateEnsemble;
+
 /**
  * \brief Créé une structure contenant un automate et un int
  * L'automate n'est pas créé par cette fonction. L'utilisateur doit le gérer lui-même.
@@ -133,34 +205,198 @@ void print_cle( const Cle * a){
 	printf( "(%d, %c)" , a->origine, (char) (a->lettre) );
 }
 
-void supprimer_cle( Cle* cle ){
-	xfree( cle );
-}
-
 void initialiser_cle( Cle* cle, int origine, char lettre ){
 	cle->origine = origine;
 	cle->lettre = (int) lettre;
 }
 
-Cle * creer_cle( int origine, char lettre ){
-	Cle * result = xmalloc( sizeof(Cle) );
-	initialiser_cle( result, origine, lettre );
-	return result;
+Ligne_transitions * creer_ligne_transitions(){
+	Ligne_transitions * ligne = xmalloc( sizeof(Ligne_transitions) );
+	Ligne_transitions_initialiser( ligne );
+	return ligne;
+}
+
+void liberer_ligne_transitions( Ligne_transitions * ligne ){
+	Ligne_transitions_liberer( ligne );
+	xfree( ligne );
+}
+
+/*
+ * Libère une ligne de la table 'lignes_inverses', avec ses ensembles.
+ */
+void liberer_ligne_predecesseurs( Ligne_transitions * ligne ){
+	size_t i;
+	for( i=0; i<ligne->nb; i++ ){
+		liberer_ensemble( ligne->valeurs[i] );
+	}
+	liberer_ligne_transitions( ligne );
+}
+
+Ligne_transitions * ligne_dans( const Table * lignes, int etat ){
+	const intptr_t * ligne = chercher_valeur_table( lignes, etat );
+	if( ! ligne ){
+		return NULL;
+	}
+	return (Ligne_transitions *) *ligne;
+}
+
+Ligne_transitions * ligne_de( const Automate * automate, int etat ){
+	return ligne_dans( automate->lignes, etat );
+}
+
+/*
+ * Renvoie l'ensemble des fins des transitions ('origine', 'lettre', .), ou 
+ * NULL s'il n'y a aucune transition de cette forme.
+ */
+Ensemble * transitions_depuis( 
+	const Automate * automate, int origine, char lettre 
+){
+	const Ligne_transitions * ligne = ligne_de( automate, origine );
+	if( ligne ){
+		Ensemble ** fins = Ligne_transitions_trouver( ligne, lettre );
+		if( fins ){
+			return *fins;
+		}
+	}
+	return NULL;
+}
+
+/*
+ * Ajoute à la ligne de l'état 'origine' l'ensemble des fins des transitions
+ * ('origine', 'lettre', .). La lettre ne doit pas déjà être dans la ligne.
+ */
+void indexer_transitions( 
+	Automate * automate, int origine, char lettre, Ensemble * fins
+){
+	int nouvelle;
+	intptr_t * place = trouver_ou_ajouter_table( 
+		automate->lignes, origine, &nouvelle 
+	);
+	if( nouvelle ){
+		*place = (intptr_t) creer_ligne_transitions();
+	}
+	Ligne_transitions * ligne = (Ligne_transitions *) *place;
+	*Ligne_transitions_trouver_ou_ajouter( ligne, lettre, NULL ) = fins;
+}
+
+/*
+ * Ajoute la transition ('origine', 'lettre', 'fin') à l'index des 
+ * prédécesseurs, qui doit être actif.
+ */
+void indexer_predecesseur( 
+	Automate * automate, int origine, char lettre, int fin
+){
+	int nouvelle;
+	intptr_t * place = trouver_ou_ajouter_table( 
+		automate->lignes_inverses, fin, &nouvelle 
+	);
+	if( nouvelle ){
+		*place = (intptr_t) creer_ligne_transitions();
+	}
+	Ligne_transitions * ligne = (Ligne_transitions *) *place;
+	Ensemble ** origines = Ligne_transitions_trouver_ou_ajouter( 
+		ligne, lettre, &nouvelle 
+	);
+	if( nouvelle ){
+		*origines = creer_ensemble( NULL, NULL, NULL );
+	}
+	ajouter_element( *origines, origine );
+}
+
+/*
+ * Retire la transition ('origine', 'lettre', 'fin') de l'index des 
+ * prédécesseurs, qui doit être actif.
+ */
+void retirer_predecesseur( 
+	Automate * automate, int origine, char lettre, int fin
+){
+	Ligne_transitions * ligne = ligne_dans( automate->lignes_inverses, fin );
+	if( ! ligne ) return;
+	Ensemble ** origines = Ligne_transitions_trouver( ligne, lettre );
+	if( ! origines ) return;
+	retirer_element( *origines, origine );
+	if( taille_ensemble( *origines ) == 0 ){
+		liberer_ensemble( *origines );
+		Ligne_transitions_retirer( ligne, lettre );
+	}
+}
+
+void ajouter_predecesseur_a_l_index( 
+	int origine, char lettre, int fin, void* automate 
+){
+	indexer_predecesseur( (Automate *) automate, origine, lettre, fin );
+}
+
+void indexer_predecesseurs( Automate * automate ){
+	if( automate->lignes_inverses ) return;
+	automate->lignes_inverses = creer_table_hachage( NULL, NULL, NULL, NULL );
+	pour_toute_transition( automate, ajouter_predecesseur_a_l_index, automate );
+}
+
+/*
+ * Retire de l'automate toutes les transitions ('origine', 'lettre', .).
+ */
+void retirer_transitions( Automate * automate, int origine, char lettre ){
+	Ligne_transitions * ligne = ligne_de( automate, origine );
+	if( ! ligne ) return;
+	Ensemble ** fins = Ligne_transitions_trouver( ligne, lettre );
+	if( ! fins ) return;
+
+	if( automate->lignes_inverses ){
+		Ensemble_curseur it;
+		for(
+			placer_curseur_ensemble( &it, *fins );
+			! curseur_ensemble_est_vide( &it );
+			avancer_curseur_ensemble( &it )
+		){
+			retirer_predecesseur( 
+				automate, origine, lettre, element_du_curseur( &it ) 
+			);
+		}
+	}
+	liberer_ensemble( *fins );
+	Ligne_transitions_retirer( ligne, lettre );
+
+	Cle cle;
+	initialiser_cle( &cle, origine, lettre );
+	delete_table( automate->transitions, (intptr_t) &cle );
 }
 
-Cle * copier_cle( const Cle* cle ){
-	return creer_cle( cle->origine, cle->lettre );
+/*
+ * Reconstruit les lignes de transitions à partir de la table des transitions.
+ *
+ * La table est parcourue dans l'ordre (origine, lettre) : chaque lettre est 
+ * donc ajoutée à la fin de sa ligne.
+ */
+void reconstruire_lignes( Automate * automate ){
+	Table_curseur it;
+	for(
+		placer_curseur_table( &it, automate->transitions );
+		! curseur_table_est_vide( &it );
+		avancer_curseur_table( &it )
+	){
+		Cle * cle = (Cle*) cle_du_curseur_table( &it );
+		Ensemble * fins = (Ensemble*) valeur_du_curseur_table( &it );
+		indexer_transitions( automate, cle->origine, cle->lettre, fins );
+	}
 }
 
 Automate * creer_automate(){
 	Automate * automate = xmalloc( sizeof(Automate) );
 	automate->etats = creer_ensemble( NULL, NULL, NULL );
+	automate->rangs = creer_table_hachage( NULL, NULL, NULL, NULL );
 	automate->alphabet = creer_ensemble( NULL, NULL, NULL );
-	automate->transitions = creer_table(
-		( int(*)(const intptr_t, const intptr_t) ) comparer_cle , 
-		( intptr_t (*)( const intptr_t ) ) copier_cle,
-		( void(*)(intptr_t) ) supprimer_cle
+	// Les clés (origine, lettre) sont rangées directement dans la table.
+	automate->transitions = creer_table_cles_fixes(
+		sizeof( Cle ),
+		( int(*)(const intptr_t, const intptr_t) ) comparer_cle
 	);
+	automate->lignes = creer_table_hachage( NULL, NULL, NULL, NULL );
+	automate->lignes_inverses = NULL;
+	automate->epsilon = creer_table( NULL, NULL, NULL );
+	automate->clotures = creer_table_hachage( NULL, NULL, NULL, NULL );
+	automate->generation_epsilon = 0;
+	automate->generation_clotures = 0;
 	automate->initiaux = creer_ensemble( NULL, NULL, NULL );
 	automate->finaux = creer_ensemble( NULL, NULL, NULL );
 	automate->vide = creer_ensemble( NULL, NULL, NULL ); 
@@ -176,8 +412,28 @@ void liberer_automate( Automate * automate ){
 		automate->transitions, ( void(*)(intptr_t) ) liberer_ensemble
 	);
 	liberer_table( automate->transitions );
+	pour_toute_valeur_table(
+		automate->lignes, ( void(*)(intptr_t) ) liberer_ligne_transitions
+	);
+	liberer_table( automate->lignes );
+	if( automate->lignes_inverses ){
+		pour_toute_valeur_table(
+			automate->lignes_inverses, 
+			( void(*)(intptr_t) ) liberer_ligne_predecesseurs
+		);
+		liberer_table( automate->lignes_inverses );
+	}
+	pour_toute_valeur_table(
+		automate->epsilon, ( void(*)(intptr_t) ) liberer_ensemble
+	);
+	liberer_table( automate->epsilon );
+	pour_toute_valeur_table(
+		automate->clotures, ( void(*)(intptr_t) ) liberer_ensemble
+	);
+	liberer_table( automate->clotures );
 	liberer_ensemble( automate->alphabet );
 	liberer_ensemble( automate->etats );
+	liberer_table( automate->rangs );
 	xfree(automate);
 }
 
@@ -197,8 +453,35 @@ const Ensemble * get_alphabet( const Automate* automate ){
 	return automate->alphabet;
 }
 
+/*
+ * Donne à l'état, s'il n'en a pas encore, le rang suivant dans l'ordre 
+ * d'ajout des états : les rangs des états de l'automate sont exactement 
+ * 0, ..., taille_ensemble( automate->etats ) - 1 (aucun état n'est jamais 
+ * retiré). Les parcours en largeur s'en servent pour indexer leur tableau de
+ * bits.
+ */
+void ranger_etat( const intptr_t etat, void* data ){
+	Automate * automate = (Automate *) data;
+	int nouvelle;
+	intptr_t * rang = trouver_ou_ajouter_table( 
+		automate->rangs, etat, &nouvelle 
+	);
+	if( nouvelle ){
+		*rang = taille_table( automate->rangs ) - 1;
+	}
+}
+
 void ajouter_etat( Automate * automate, int etat ){
 	ajouter_element( automate->etats, etat );
+	ranger_etat( etat, automate );
+}
+
+/*
+ * Ajoute tous les états de l'ensemble à l'automate.
+ */
+void ajouter_etats( Automate * automate, const Ensemble * etats ){
+	ajouter_elements( automate->etats, etats );
+	pour_tout_element( etats, ranger_etat, automate );
 }
 
 void ajouter_lettre( Automate * automate, char lettre ){
@@ -214,20 +497,166 @@ void ajouter_transition(
 
 	Cle cle;
 	initialiser_cle( &cle, origine, lettre );
-	Table_iterateur it = trouver_table( automate->transitions, (intptr_t) &cle );
-	Ensemble * ens;
-	if( iterateur_est_vide( it ) ){
-		ens = creer_ensemble( NULL, NULL, NULL );
-		add_table( automate->transitions, (intptr_t) &cle, (intptr_t) ens );
-	}else{
-		ens = (Ensemble*) get_valeur( it );
+	int nouvelle;
+	intptr_t * fins = trouver_ou_ajouter_table( 
+		automate->transitions, (intptr_t) &cle, &nouvelle 
+	);
+	if( nouvelle ){
+		*fins = (intptr_t) creer_ensemble( NULL, NULL, NULL );
+		indexer_transitions( automate, origine, lettre, (Ensemble *) *fins );
+	}
+	ajouter_element( (Ensemble *) *fins, fin );
+	if( automate->lignes_inverses ){
+		indexer_predecesseur( automate, origine, lettre, fin );
+	}
+}
+
+/*
+ * Vide le cache des ε-clôtures de l'automate.
+ */
+void oublier_clotures( Automate * automate ){
+	pour_toute_valeur_table(
+		automate->clotures, ( void(*)(intptr_t) ) liberer_ensemble
+	);
+	vider_table( automate->clotures );
+}
+
+/*
+ * Renvoie l'ensemble des fins des ε-transitions de l'état 'origine', en le 
+ * créant s'il n'existe pas encore.
+ */
+Ensemble * fins_epsilon( Automate * automate, int origine ){
+	int nouvelle;
+	intptr_t * place = trouver_ou_ajouter_table( 
+		automate->epsilon, origine, &nouvelle 
+	);
+	if( nouvelle ){
+		*place = (intptr_t) creer_ensemble( NULL, NULL, NULL );
 	}
-	ajouter_element( ens, fin );
+	return (Ensemble *) *place;
 }
 
 void ajouter_epsilon_transition(Automate * automate, int origine, int fin)
 {
-	ajouter_transition(automate, origine, '#' ,fin);
+	ajouter_etat( automate, origine );
+	ajouter_etat( automate, fin );
+	ajouter_element( fins_epsilon( automate, origine ), fin );
+	automate->generation_epsilon++;
+}
+
+/*
+ * Ajoute les ε-transitions ('origine', fins[i]) pour i de 0 à nb-1.
+ * Les états fins[i] doivent être des états de l'automate, rangés par ordre 
+ * strictement croissant : si l'état 'origine' n'avait encore aucune 
+ * ε-transition, leur ensemble est construit en temps linéaire.
+ */
+void ajouter_epsilon_transitions_triees(
+	Automate * automate, int origine, const intptr_t * fins, unsigned int nb
+){
+	if( nb == 0 ) return;
+	ajouter_etat( automate, origine );
+	int nouvelle;
+	intptr_t * place = trouver_ou_ajouter_table( 
+		automate->epsilon, origine, &nouvelle 
+	);
+	if( nouvelle ){
+		*place = (intptr_t) creer_ensemble_depuis_tableau_trie( 
+			NULL, NULL, NULL, fins, nb 
+		);
+	}else{
+		unsigned int i;
+		for( i=0; i<nb; i++ ){
+			ajouter_element( (Ensemble *) *place, fins[i] );
+		}
+	}
+	automate->generation_epsilon++;
+}
+
+const Ensemble * epsilon_voisins( const Automate* automate, int origine ){
+	const intptr_t * fins = chercher_valeur_table( automate->epsilon, origine );
+	if( ! fins ){
+		return automate->vide;
+	}
+	return (const Ensemble *) *fins;
+}
+
+int est_une_epsilon_transition_de_l_automate(
+	const Automate* automate, int origine, int fin
+){
+	return est_dans_l_ensemble( epsilon_voisins( automate, origine ), fin );
+}
+
+int a_des_epsilon_transitions( const Automate* automate ){
+	return taille_table( automate->epsilon ) > 0;
+}
+
+void pour_toute_epsilon_transition(
+	const Automate* automate,
+	void (* action )( int origine, int fin, void* data ),
+	void* data
+){
+	Table_curseur it1;
+	Ensemble_curseur it2;
+	for(
+		placer_curseur_table( &it1, automate->epsilon );
+		! curseur_table_est_vide( &it1 );
+		avancer_curseur_table( &it1 )
+	){
+		int origine = cle_du_curseur_table( &it1 );
+		for(
+			placer_curseur_ensemble( 
+				&it2, (Ensemble *) valeur_du_curseur_table( &it1 ) 
+			);
+			! curseur_ensemble_est_vide( &it2 );
+			avancer_curseur_ensemble( &it2 )
+		){
+			action( origine, element_du_curseur( &it2 ), data );
+		}
+	}
+}
+
+/**
+ * \par Implémentation
+ * La clôture est calculée par un parcours des seules ε-transitions, puis 
+ * rangée dans le cache de l'automate, vidé d'abord si des ε-transitions ont
+ * été ajoutées depuis. Le cache ne change pas le comportement de 
+ * l'automate : c'est pourquoi il est modifié malgré le 'const', et pourquoi 
+ * la fonction n'est pas thread-safe.
+ */
+const Ensemble * epsilon_cloture( const Automate* automate, int etat ){
+	Automate * cache = (Automate *) automate;
+	if( automate->generation_clotures != automate->generation_epsilon ){
+		oublier_clotures( cache );
+		cache->generation_clotures = automate->generation_epsilon;
+	}
+	const intptr_t * deja_calculee = chercher_valeur_table( 
+		automate->clotures, etat 
+	);
+	if( deja_calculee ){
+		return (const Ensemble *) *deja_calculee;
+	}
+	Ensemble * cloture = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( cloture, etat );
+	Fifo * a_traiter = creer_fifo();
+	ajouter_fifo( a_traiter, etat );
+	Ensemble_curseur it2;
+	while( ! est_vide( a_traiter ) ){
+		int origine = retirer_fifo( a_traiter );
+		for(
+			placer_curseur_ensemble( &it2, epsilon_voisins( automate, origine ) );
+			! curseur_ensemble_est_vide( &it2 );
+			avancer_curseur_ensemble( &it2 )
+		){
+			int fin = element_du_curseur( &it2 );
+			if( ! est_dans_l_ensemble( cloture, fin ) ){
+				ajouter_element( cloture, fin );
+				ajouter_fifo( a_traiter, fin );
+			}
+		}
+	}
+	liberer_fifo( a_traiter );
+	add_table( cache->clotures, etat, (intptr_t) cloture );
+	return cloture;
 }
 
 void ajouter_etat_final(
@@ -245,11 +674,9 @@ void ajouter_etat_initial(
 }
 
 const Ensemble * voisins( const Automate* automate, int origine, char lettre ){
-	Cle cle;
-	initialiser_cle( &cle, origine, lettre );
-	Table_iterateur it = trouver_table( automate->transitions, (intptr_t) &cle );
-	if( ! iterateur_est_vide( it ) ){
-		return (Ensemble*) get_valeur( it );
+	const Ensemble * ens = transitions_depuis( automate, origine, lettre );
+	if( ens ){
+		return ens;
 	}else{
 		return automate->vide;
 	}
@@ -268,14 +695,14 @@ Ensemble * delta(
 ){
 	Ensemble * res = creer_ensemble( NULL, NULL, NULL );
 
-	Ensemble_iterateur it;
+	Ensemble_curseur it;
 	for( 
-		it = premier_iterateur_ensemble( etats_courants );
-		! iterateur_ensemble_est_vide( it );
-		it = iterateur_suivant_ensemble( it )
+		placer_curseur_ensemble( &it, etats_courants );
+		! curseur_ensemble_est_vide( &it );
+		avancer_curseur_ensemble( &it )
 	){
 		const Ensemble * fins = voisins(
-			automate, get_element( it ), lettre
+			automate, element_du_curseur( &it ), lettre
 		);
 		ajouter_elements( res, fins );
 	}
@@ -292,120 +719,158 @@ Ensemble * delta_star(
 	for(i = 0; i < strlen(mot); i++)
 	{
 		fins = delta(automate, fins, mot[i]);
-		ajouter_elements(res, fins);
+		union_dans(res, fins);
 	}
 
 	return res;
 }
 
-void pour_toute_transition(
-	const Automate* automate,
+void pour_toute_transition_depuis(
+	const Automate* automate, int origine,
 	void (* action )( int origine, char lettre, int fin, void* data ),
 	void* data
 ){
-	Table_iterateur it1;
-	Ensemble_iterateur it2;
-	for(
-		it1 = premier_iterateur_table( automate->transitions );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
-	){
-		Cle * cle = (Cle*) get_cle( it1 );
-		Ensemble * fins = (Ensemble*) get_valeur( it1 );
+	const Ligne_transitions * ligne = ligne_de( automate, origine );
+	if( ! ligne ) return;
+	size_t i;
+	Ensemble_curseur it;
+	for( i=0; i<ligne->nb; i++ ){
 		for(
-			it2 = premier_iterateur_ensemble( fins );
-			! iterateur_ensemble_est_vide( it2 );
-			it2 = iterateur_suivant_ensemble( it2 )
+			placer_curseur_ensemble( &it, ligne->valeurs[i] );
+			! curseur_ensemble_est_vide( &it );
+			avancer_curseur_ensemble( &it )
 		){
-			int fin = get_element( it2 );
-			action( cle->origine, cle->lettre, fin, data );
+			action( origine, ligne->cles[i], element_du_curseur( &it ), data );
 		}
-	};
+	}
 }
 
-Automate* copier_automate( const Automate* automate ){
-	Automate * res = creer_automate();
-	Ensemble_iterateur it1;
-	// On ajoute les états de l'automate
-	for(
-		it1 = premier_iterateur_ensemble( get_etats( automate ) );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
-	){
-		ajouter_etat( res, get_element( it1 ) );
-	}
-	// On ajoute les états initiaux
-	for(
-		it1 = premier_iterateur_ensemble( get_initiaux( automate ) );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
-	){
-		ajouter_etat_initial( res, get_element( it1 ) );
+/*
+ * Appelle l'action sur la transition si elle arrive dans l'état cherché.
+ */
+typedef struct {
+	int fin;
+	void (* action )( int origine, char lettre, int fin, void* data );
+	void* data;
+} Transition_vers;
+
+void filtrer_transition_vers( int origine, char lettre, int fin, void* data ){
+	Transition_vers * filtre = (Transition_vers *) data;
+	if( fin == filtre->fin ){
+		filtre->action( origine, lettre, fin, filtre->data );
 	}
-	// On ajoute les états finaux
-	for(
-		it1 = premier_iterateur_ensemble( get_finaux( automate ) );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
-	){
-		ajouter_etat_final( res, get_element( it1 ) );
+}
+
+void pour_toute_transition_vers(
+	const Automate* automate, int fin,
+	void (* action )( int origine, char lettre, int fin, void* data ),
+	void* data
+){
+	if( ! automate->lignes_inverses ){
+		Transition_vers filtre;
+		filtre.fin = fin;
+		filtre.action = action;
+		filtre.data = data;
+		pour_toute_transition( automate, filtrer_transition_vers, &filtre );
+		return;
 	}
-	// On ajoute les lettres
-	for(
-		it1 = premier_iterateur_ensemble( get_alphabet( automate ) );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
-	){
-		ajouter_lettre( res, (char) get_element( it1 ) );
+	const Ligne_transitions * ligne = ligne_dans( automate->lignes_inverses, fin );
+	if( ! ligne ) return;
+	size_t i;
+	Ensemble_curseur it;
+	for( i=0; i<ligne->nb; i++ ){
+		for(
+			placer_curseur_ensemble( &it, ligne->valeurs[i] );
+			! curseur_ensemble_est_vide( &it );
+			avancer_curseur_ensemble( &it )
+		){
+			action( element_du_curseur( &it ), ligne->cles[i], fin, data );
+		}
 	}
-	// On ajoute les transitions
-	Table_iterateur it2;
+}
+
+void pour_toute_transition(
+	const Automate* automate,
+	void (* action )( int origine, char lettre, int fin, void* data ),
+	void* data
+){
+	Table_curseur it1;
+	Ensemble_curseur it2;
 	for(
-		it2 = premier_iterateur_table( automate->transitions );
-		! iterateur_ensemble_est_vide( it2 );
-		it2 = iterateur_suivant_ensemble( it2 )
+		placer_curseur_table( &it1, automate->transitions );
+		! curseur_table_est_vide( &it1 );
+		avancer_curseur_table( &it1 )
 	){
-		Cle * cle = (Cle*) get_cle( it2 );
-		Ensemble * fins = (Ensemble*) get_valeur( it2 );
+		Cle * cle = (Cle*) cle_du_curseur_table( &it1 );
+		Ensemble * fins = (Ensemble*) valeur_du_curseur_table( &it1 );
 		for(
-			it1 = premier_iterateur_ensemble( fins );
-			! iterateur_ensemble_est_vide( it1 );
-			it1 = iterateur_suivant_ensemble( it1 )
+			placer_curseur_ensemble( &it2, fins );
+			! curseur_ensemble_est_vide( &it2 );
+			avancer_curseur_ensemble( &it2 )
 		){
-			int fin = get_element( it1 );
-			ajouter_transition( res, cle->origine, cle->lettre, fin );
+			int fin = element_du_curseur( &it2 );
+			action( cle->origine, cle->lettre, fin, data );
 		}
 	};
+}
+
+Automate* copier_automate( const Automate* automate ){
+	Automate * res = xmalloc( sizeof(Automate) );
+	// Les ensembles et la table des transitions sont recopiés en temps 
+	// linéaire, sans réinsérer leurs éléments un par un.
+	res->etats = copier_ensemble( automate->etats );
+	res->rangs = copier_table( automate->rangs, NULL );
+	res->alphabet = copier_ensemble( automate->alphabet );
+	res->transitions = copier_table(
+		automate->transitions,
+		( intptr_t (*)( const intptr_t ) ) copier_ensemble
+	);
+	res->lignes = creer_table_hachage( NULL, NULL, NULL, NULL );
+	reconstruire_lignes( res );
+	res->lignes_inverses = NULL;
+	if( automate->lignes_inverses ){
+		indexer_predecesseurs( res );
+	}
+	res->epsilon = copier_table(
+		automate->epsilon,
+		( intptr_t (*)( const intptr_t ) ) copier_ensemble
+	);
+	res->clotures = creer_table_hachage( NULL, NULL, NULL, NULL );
+	res->generation_epsilon = 0;
+	res->generation_clotures = 0;
+	res->initiaux = copier_ensemble( automate->initiaux );
+	res->finaux = copier_ensemble( automate->finaux );
+	res->vide = creer_ensemble( NULL, NULL, NULL );
 	return res;
 }
 
 Automate * translater_etat( const Automate* automate, int n ){
 	Automate * res = creer_automate();
 
-	Ensemble_iterateur it;
+	Ensemble_curseur it;
 	for( 
-		it = premier_iterateur_ensemble( get_etats( automate ) );
-		! iterateur_ensemble_est_vide( it );
-		it = iterateur_suivant_ensemble( it )
+		placer_curseur_ensemble( &it, get_etats( automate ) );
+		! curseur_ensemble_est_vide( &it );
+		avancer_curseur_ensemble( &it )
 	){
-		ajouter_etat( res, get_element( it ) + n );
+		ajouter_etat( res, element_du_curseur( &it ) + n );
 	}
 
-	Table_iterateur it1;
-	Ensemble_iterateur it2;
+	Table_curseur it1;
+	Ensemble_curseur it2;
 	for(
-		it1 = premier_iterateur_table( automate->transitions );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
+		placer_curseur_table( &it1, automate->transitions );
+		! curseur_table_est_vide( &it1 );
+		avancer_curseur_table( &it1 )
 	){
-		Cle * cle = (Cle*) get_cle( it1 );
-		Ensemble * fins = (Ensemble*) get_valeur( it1 );
+		Cle * cle = (Cle*) cle_du_curseur_table( &it1 );
+		Ensemble * fins = (Ensemble*) valeur_du_curseur_table( &it1 );
 		for(
-			it2 = premier_iterateur_ensemble( fins );
-			! iterateur_ensemble_est_vide( it2 );
-			it2 = iterateur_suivant_ensemble( it2 )
+			placer_curseur_ensemble( &it2, fins );
+			! curseur_ensemble_est_vide( &it2 );
+			avancer_curseur_ensemble( &it2 )
 		){
-			int fin = get_valeur( it2 );
+			int fin = element_du_curseur( &it2 );
 			ajouter_transition(
 				res, cle->origine + n, cle->lettre, fin + n
 			);
@@ -473,160 +938,443 @@ Automate * creer_automate_des_sur_mots(
 }
 
 
-Ensemble* etats_accessibles( const Automate * automate, int etat ){
-	Ensemble * res = creer_ensemble(NULL, NULL, NULL);
-	Ensemble * etape = creer_ensemble(NULL, NULL, NULL);	
-	ajouter_element(etape, etat);
-	Ensemble_iterateur it_lettre;
-	Ensemble_iterateur it_etat;
-
-	// Tant que des états sont à traiter
-	while (taille_ensemble(etape) > 0)
-	{
-		Ensemble * trouves = creer_ensemble(NULL, NULL, NULL);
-		for(
-			it_lettre = premier_iterateur_ensemble( get_alphabet( automate ) );
-		! iterateur_ensemble_est_vide( it_lettre );
-		it_lettre = iterateur_suivant_ensemble( it_lettre )
-		){
-			for(
-				it_etat = premier_iterateur_ensemble(etape);
-			! iterateur_ensemble_est_vide( it_etat );
-			it_etat = iterateur_suivant_ensemble( it_etat )
-			){
-				// on ajoute les voisins aux éléments trouvés
-				ajouter_elements(trouves, voisins(automate, 
-									get_element(it_etat), 
-									get_element(it_lettre)
-									));				
-			}
-		}
-		etape = creer_difference_ensemble(trouves, res);
-		ajouter_elements(res, etape);
-	}	
-
-	return res;
+/*
+ * Parcours en largeur des états d'un automate.
+ *
+ * Les états de l'automate sont repérés par le rang 0, ..., nb_etats - 1 que
+ * l'automate leur a donné à leur ajout (voir ranger_etat()). Ainsi, la 
+ * mémoire du parcours ne dépend que du nombre d'états, et non de l'écart 
+ * entre le plus petit et le plus grand d'entre eux, et le parcours ne 
+ * construit aucune table. 'vus' est un tableau de bits indexé par les rangs. 'file' contient 
+ * les états à traiter (entre 'debut' et 'fin') puis traités : un état n'y 
+ * entre qu'au moment où il est marqué comme vu, et les états de départ n'y 
+ * entrent qu'une fois de plus, si bien que 'file' ne déborde jamais.
+ *
+ * Pour un parcours à rebours des transitions, les origines des transitions 
+ * qui arrivent dans l'état de rang i sont rangées dans 'predecesseurs', de 
+ * l'indice debuts_predecesseurs[i] (inclus) à debuts_predecesseurs[i+1] 
+ * (exclu). Sinon, ces tableaux valent NULL et le parcours suit les lignes 
+ * de la table 'lignes' : les lignes de l'automate, ou ses lignes inverses 
+ * si l'index des prédécesseurs est actif.
+ */
+typedef struct {
+	const Automate * automate;
+	const Table * lignes;
+	size_t nb_etats;
+	unsigned long * vus;
+	intptr_t * file;
+	size_t debut;
+	size_t fin;
+	size_t * debuts_predecesseurs;
+	intptr_t * predecesseurs;
+} Parcours_largeur;
+
+#define BITS_PAR_MOT ( 8 * sizeof( unsigned long ) )
+
+void initialiser_parcours_largeur(
+	Parcours_largeur * parcours, const Automate * automate, size_t nb_departs
+){
+	parcours->automate = automate;
+	parcours->lignes = automate->lignes;
+	parcours->nb_etats = taille_ensemble( automate->etats );
+	size_t nb_mots = ( parcours->nb_etats + BITS_PAR_MOT - 1 ) / BITS_PAR_MOT;
+	parcours->vus = xmalloc( ( nb_mots + 1 ) * sizeof( unsigned long ) );
+	memset( parcours->vus, 0, ( nb_mots + 1 ) * sizeof( unsigned long ) );
+	parcours->file = xmalloc(
+		( taille_ensemble( automate->etats ) + nb_departs + 1 ) 
+		* sizeof( intptr_t )
+	);
+	parcours->debut = 0;
+	parcours->fin = 0;
+	parcours->debuts_predecesseurs = NULL;
+	parcours->predecesseurs = NULL;
 }
 
-Automate *automate_accessible( const Automate * automate){
-	/*printf("[Automate accessible] Début fonction....\n");
-	Automate* clone = copier_automate(automate);
-	Ensemble* etats = creer_ensemble(NULL, NULL, NULL);
-	Ensemble_iterateur it_etat;
-	for(it_etat = premier_iterateur_ensemble(get_initiaux(automate));
-		! iterateur_ensemble_est_vide( it_etat );
-		it_etat = iterateur_suivant_ensemble( it_etat )){
-		ajouter_elements(etats, etats_accessibles(automate, get_element(it_etat)));
-	}
-
-	Ensemble* non_accessible = creer_difference_ensemble(get_etats(automate), etats);
-	printf("print ensemble (non_accessible)\n");	
-	print_ensemble(non_accessible, NULL);
-	printf("\n\n");
-
-	for(it_etat = premier_iterateur_ensemble(non_accessible);
-		! iterateur_ensemble_est_vide( it_etat );
-		it_etat = iterateur_suivant_ensemble( it_etat )){
-		if (est_une_transition_de_l_automate(automate))
-	}
-	return clone;*/
-	return NULL;
+/*
+ * Renvoie le rang de l'état, qui doit être un état de l'automate.
+ */
+size_t rang_dans_parcours( const Parcours_largeur * parcours, int etat ){
+	return (size_t) *chercher_valeur_table( parcours->automate->rangs, etat );
 }
 
-void reverse_transition(int origine, char lettre, int fin, void* automate)
-{
-	ajouter_transition(automate, fin, lettre, origine);
+void compter_predecesseur( int origine, char lettre, int fin, void* data ){
+	Parcours_largeur * parcours = (Parcours_largeur *) data;
+	parcours->debuts_predecesseurs[ rang_dans_parcours( parcours, fin ) + 1 ]++;
 }
 
-Automate *miroir( const Automate * automate){
-	Automate* clone = creer_automate();
-	ajouter_elements(clone->initiaux, automate->finaux);
-	ajouter_elements(clone->finaux, automate->initiaux);
+void ranger_predecesseur( int origine, char lettre, int fin, void* data ){
+	Parcours_largeur * parcours = (Parcours_largeur *) data;
+	size_t * place = 
+		&parcours->debuts_predecesseurs[ rang_dans_parcours( parcours, fin ) ];
+	parcours->predecesseurs[ (*place)++ ] = origine;
+}
 
-	pour_toute_transition(automate, reverse_transition, clone);
-	return clone;
+void compter_epsilon_predecesseur( int origine, int fin, void* data ){
+	compter_predecesseur( origine, 0, fin, data );
 }
 
-Automate *automate_co_accessible( const Automate * automate){
-	A_FAIRE_RETURN(NULL);
+void ranger_epsilon_predecesseur( int origine, int fin, void* data ){
+	ranger_predecesseur( origine, 0, fin, data );
 }
 
-Automate * creer_automate_des_prefixes( const Automate* automate ){
-	Automate * prefixe = copier_automate(automate);
-	Ensemble * finaux = prefixe->finaux;
-	Ensemble_iterateur it1, it2;
-	int etat_actuel, est_ok;
-	
-	est_ok = 0;
-	
-	for (it1 = premier_iterateur_ensemble(get_etats(prefixe)); ! iterateur_ensemble_est_vide(it1); it1 = iterateur_suivant_ensemble(it1)){
-			
-		etat_actuel = get_element(it1);
-		for (it2 = premier_iterateur_ensemble(finaux); !iterateur_ensemble_est_vide(it2) && !est_ok; it2 = iterateur_suivant_ensemble(it2)){
-			
-			if (est_dans_l_ensemble(etats_accessibles(prefixe, etat_actuel), get_element(it2))) {
+/*
+ * Prépare le parcours à suivre les transitions (et les ε-transitions) à 
+ * rebours. Si l'index des prédécesseurs n'est pas actif, ou si l'automate a
+ * des ε-transitions, qui ne sont pas dans l'index, les origines des 
+ * transitions sont rangées par état d'arrivée, en deux passes sur les 
+ * transitions.
+ */
+void inverser_parcours_largeur( Parcours_largeur * parcours ){
+	if( 
+		parcours->automate->lignes_inverses 
+		&& ! a_des_epsilon_transitions( parcours->automate )
+	){
+		parcours->lignes = parcours->automate->lignes_inverses;
+		return;
+	}
+	size_t nb = parcours->nb_etats;
+	size_t i;
+	parcours->debuts_predecesseurs = xmalloc( ( nb + 1 ) * sizeof( size_t ) );
+	memset( parcours->debuts_predecesseurs, 0, ( nb + 1 ) * sizeof( size_t ) );
+	pour_toute_transition( parcours->automate, compter_predecesseur, parcours );
+	pour_toute_epsilon_transition( 
+		parcours->automate, compter_epsilon_predecesseur, parcours 
+	);
+	for( i=0; i<nb; i++ ){
+		parcours->debuts_predecesseurs[i+1] += parcours->debuts_predecesseurs[i];
+	}
+	parcours->predecesseurs = xmalloc(
+		( parcours->debuts_predecesseurs[nb] + 1 ) * sizeof( intptr_t )
+	);
+	// Chaque état reçoit ses origines à partir de son début : les débuts 
+	// sont alors décalés d'un cran, ce qui est rattrapé ensuite.
+	pour_toute_transition( parcours->automate, ranger_predecesseur, parcours );
+	pour_toute_epsilon_transition( 
+		parcours->automate, ranger_epsilon_predecesseur, parcours 
+	);
+	for( i=nb; i>0; i-- ){
+		parcours->debuts_predecesseurs[i] = parcours->debuts_predecesseurs[i-1];
+	}
+	parcours->debuts_predecesseurs[0] = 0;
+}
 
-				est_ok = 1;
-				ajouter_etat_final(prefixe, etat_actuel);
+/*
+ * Marque l'état comme vu et l'ajoute à la file s'il ne l'était pas déjà.
+ */
+void visiter_etat( Parcours_largeur * parcours, int etat ){
+	size_t i = rang_dans_parcours( parcours, etat );
+	unsigned long bit = 1UL << ( i % BITS_PAR_MOT );
+	if( parcours->vus[ i / BITS_PAR_MOT ] & bit ) return;
+	parcours->vus[ i / BITS_PAR_MOT ] |= bit;
+	parcours->file[ parcours->fin++ ] = etat;
+}
+
+/*
+ * Ajoute un état de départ. Il n'est pas marqué comme vu : il ne fera partie
+ * du résultat que s'il est accessible depuis un état de départ.
+ * Un état qui n'est pas dans l'automate n'a aucune transition : il est 
+ * ignoré.
+ */
+void ajouter_depart_parcours_largeur( Parcours_largeur * parcours, int etat ){
+	if( chercher_valeur_table( parcours->automate->rangs, etat ) ){
+		parcours->file[ parcours->fin++ ] = etat;
+	}
+}
+
+/*
+ * Traite les états de la file jusqu'à ce qu'elle soit vide : chaque état 
+ * et chaque transition ne sont examinés qu'une fois.
+ */
+void parcourir_en_largeur( Parcours_largeur * parcours ){
+	size_t i;
+	Ensemble_curseur it;
+	while( parcours->debut < parcours->fin ){
+		int etat = parcours->file[ parcours->debut++ ];
+		if( parcours->predecesseurs ){
+			size_t j = rang_dans_parcours( parcours, etat );
+			for(
+				i = parcours->debuts_predecesseurs[j];
+				i < parcours->debuts_predecesseurs[j+1];
+				i++
+			){
+				visiter_etat( parcours, parcours->predecesseurs[i] );
+			}
+			continue;
+		}
+		if( parcours->lignes == parcours->automate->lignes ){
+			for(
+				placer_curseur_ensemble( 
+					&it, epsilon_voisins( parcours->automate, etat ) 
+				);
+				! curseur_ensemble_est_vide( &it );
+				avancer_curseur_ensemble( &it )
+			){
+				visiter_etat( parcours, element_du_curseur( &it ) );
+			}
+		}
+		const Ligne_transitions * ligne = ligne_dans( parcours->lignes, etat );
+		if( ! ligne ) continue;
+		for( i=0; i<ligne->nb; i++ ){
+			for(
+				placer_curseur_ensemble( &it, ligne->valeurs[i] );
+				! curseur_ensemble_est_vide( &it );
+				avancer_curseur_ensemble( &it )
+			){
+				visiter_etat( parcours, element_du_curseur( &it ) );
 			}
 		}
-		
-		est_ok = 0;
 	}
-	
+}
+
+/*
+ * Renvoie l'ensemble des états vus et libère la mémoire du parcours.
+ *
+ * Les états de l'automate sont lus dans l'ordre : les états vus sont donc 
+ * déjà triés, et l'ensemble est construit en temps linéaire (en moyenne).
+ */
+Ensemble * terminer_parcours_largeur( Parcours_largeur * parcours ){
+	size_t nb = 0;
+	Ensemble_curseur it;
+	for(
+		placer_curseur_ensemble( &it, parcours->automate->etats );
+		! curseur_ensemble_est_vide( &it );
+		avancer_curseur_ensemble( &it )
+	){
+		int etat = element_du_curseur( &it );
+		size_t i = rang_dans_parcours( parcours, etat );
+		if( parcours->vus[ i / BITS_PAR_MOT ] & ( 1UL << ( i % BITS_PAR_MOT ) ) ){
+			parcours->file[ nb++ ] = etat;
+		}
+	}
+	Ensemble * res = creer_ensemble_depuis_tableau_trie(
+		NULL, NULL, NULL, parcours->file, nb
+	);
+	xfree( parcours->vus );
+	xfree( parcours->file );
+	xfree( parcours->debuts_predecesseurs );
+	xfree( parcours->predecesseurs );
+	return res;
+}
+
+/**
+ * \par Implémentation
+ * Parcours en largeur de l'automate, en temps linéaire (en moyenne) en son 
+ * nombre d'états et de transitions.
+ */
+Ensemble* etats_accessibles( const Automate * automate, int etat ){
+	Parcours_largeur parcours;
+	initialiser_parcours_largeur( &parcours, automate, 1 );
+	ajouter_depart_parcours_largeur( &parcours, etat );
+	parcourir_en_largeur( &parcours );
+	return terminer_parcours_largeur( &parcours );
+}
+
+Ensemble* etats_accessibles_depuis(
+	const Automate * automate, const Ensemble * departs
+){
+	Parcours_largeur parcours;
+	initialiser_parcours_largeur( &parcours, automate, taille_ensemble( departs ) );
+	Ensemble_curseur it;
+	for(
+		placer_curseur_ensemble( &it, departs );
+		! curseur_ensemble_est_vide( &it );
+		avancer_curseur_ensemble( &it )
+	){
+		ajouter_depart_parcours_largeur( &parcours, element_du_curseur( &it ) );
+	}
+	parcourir_en_largeur( &parcours );
+	return terminer_parcours_largeur( &parcours );
+}
+
+/**
+ * \par Implémentation
+ * Parcours en largeur des transitions à rebours, depuis les états 
+ * d'arrivée.
+ */
+Ensemble* etats_co_accessibles(
+	const Automate * automate, const Ensemble * arrivees
+){
+	Parcours_largeur parcours;
+	initialiser_parcours_largeur( 
+		&parcours, automate, taille_ensemble( arrivees ) 
+	);
+	inverser_parcours_largeur( &parcours );
+	Ensemble_curseur it;
+	for(
+		placer_curseur_ensemble( &it, arrivees );
+		! curseur_ensemble_est_vide( &it );
+		avancer_curseur_ensemble( &it )
+	){
+		ajouter_depart_parcours_largeur( &parcours, element_du_curseur( &it ) );
+	}
+	parcourir_en_largeur( &parcours );
+	return terminer_parcours_largeur( &parcours );
+}
+
+/*
+ * Ajoute la transition à l'automate restreint si ses deux extrémités sont 
+ * conservées.
+ */
+void recopier_transition_conservee( 
+	int origine, char lettre, int fin, void* data 
+){
+	AutomateEnsemble * restreint = (AutomateEnsemble *) data;
+	if(
+		est_dans_l_ensemble( restreint->ensemble, origine ) 
+		&& est_dans_l_ensemble( restreint->ensemble, fin )
+	){
+		ajouter_transition( restreint->automate, origine, lettre, fin );
+	}
+}
+
+void recopier_epsilon_transition_conservee( int origine, int fin, void* data ){
+	AutomateEnsemble * restreint = (AutomateEnsemble *) data;
+	if(
+		est_dans_l_ensemble( restreint->ensemble, origine ) 
+		&& est_dans_l_ensemble( restreint->ensemble, fin )
+	){
+		ajouter_epsilon_transition( restreint->automate, origine, fin );
+	}
+}
+
+/*
+ * Renvoie l'automate obtenu en ne gardant que les états de 'etats' (et les 
+ * transitions entre ces états). L'alphabet est conservé.
+ *
+ * Les transitions sont parcourues dans l'ordre (origine, lettre) : elles 
+ * sont donc toutes ajoutées à la fin de la table de l'automate restreint.
+ */
+Automate * restreindre_automate( 
+	const Automate * automate, const Ensemble * etats 
+){
+	Automate * res = creer_automate();
+	ajouter_elements( res->alphabet, automate->alphabet );
+	ajouter_etats( res, etats );
+	Ensemble * extremites = creer_intersection_ensemble( 
+		automate->initiaux, etats 
+	);
+	deplacer_ensemble( res->initiaux, extremites );
+	extremites = creer_intersection_ensemble( automate->finaux, etats );
+	deplacer_ensemble( res->finaux, extremites );
+
+	AutomateEnsemble restreint;
+	restreint.automate = res;
+	restreint.ensemble = etats;
+	pour_toute_transition( automate, recopier_transition_conservee, &restreint );
+	pour_toute_epsilon_transition( 
+		automate, recopier_epsilon_transition_conservee, &restreint 
+	);
+	return res;
+}
+
+/*
+ * Renvoie les états accessibles depuis un état initial, y compris les états
+ * initiaux eux-mêmes.
+ */
+Ensemble * etats_accessibles_depuis_initiaux( const Automate * automate ){
+	Ensemble * res = etats_accessibles_depuis( automate, automate->initiaux );
+	ajouter_elements( res, automate->initiaux );
+	return res;
+}
+
+/*
+ * Renvoie les états depuis lesquels un état final est accessible, y compris
+ * les états finaux eux-mêmes.
+ */
+Ensemble * etats_co_accessibles_aux_finaux( const Automate * automate ){
+	Ensemble * res = etats_co_accessibles( automate, automate->finaux );
+	ajouter_elements( res, automate->finaux );
+	return res;
+}
+
+/**
+ * \par Implémentation
+ * Un parcours en largeur depuis les états initiaux, puis une recopie des 
+ * transitions conservées.
+ */
+Automate *automate_accessible( const Automate * automate){
+	Ensemble * etats = etats_accessibles_depuis_initiaux( automate );
+	Automate * res = restreindre_automate( automate, etats );
+	liberer_ensemble( etats );
+	return res;
+}
+
+void reverse_transition(int origine, char lettre, int fin, void* automate)
+{
+	ajouter_transition(automate, fin, lettre, origine);
+}
+
+void reverse_epsilon_transition(int origine, int fin, void* automate)
+{
+	ajouter_epsilon_transition(automate, fin, origine);
+}
+
+Automate *miroir( const Automate * automate){
+	Automate* clone = creer_automate();
+	ajouter_elements(clone->initiaux, automate->finaux);
+	ajouter_elements(clone->finaux, automate->initiaux);
+
+	pour_toute_transition(automate, reverse_transition, clone);
+	pour_toute_epsilon_transition(automate, reverse_epsilon_transition, clone);
+	return clone;
+}
+
+/**
+ * \par Implémentation
+ * Un parcours en largeur à rebours depuis les états finaux, puis une recopie
+ * des transitions conservées.
+ */
+Automate *automate_co_accessible( const Automate * automate){
+	Ensemble * etats = etats_co_accessibles_aux_finaux( automate );
+	Automate * res = restreindre_automate( automate, etats );
+	liberer_ensemble( etats );
+	return res;
+}
+
+/**
+ * \par Implémentation
+ * Les deux parcours sont faits sur l'automate de départ : un état accessible
+ * et co-accessible l'est encore dans l'automate restreint à ces états, 
+ * puisque les chemins qui le relient à un état initial et à un état final 
+ * ne passent que par des états accessibles et co-accessibles.
+ */
+Automate *automate_emonde( const Automate * automate){
+	Ensemble * etats = etats_accessibles_depuis_initiaux( automate );
+	Ensemble * co_accessibles = etats_co_accessibles_aux_finaux( automate );
+	intersection_dans( etats, co_accessibles );
+	Automate * res = restreindre_automate( automate, etats );
+	liberer_ensemble( co_accessibles );
+	liberer_ensemble( etats );
+	return res;
+}
+
+/**
+ * \par Implémentation
+ * Les états depuis lesquels on peut atteindre un état final sont tous 
+ * calculés en un seul parcours à rebours (voir etats_co_accessibles()).
+ */
+Automate * creer_automate_des_prefixes( const Automate* automate ){
+	Automate * prefixe = copier_automate(automate);
+	Ensemble * co_accessibles = etats_co_accessibles( automate, automate->finaux );
+	ajouter_elements( prefixe->finaux, co_accessibles );
+	liberer_ensemble( co_accessibles );
 	return prefixe;
 }
 
 Automate * creer_automate_des_suffixes( const Automate* automate ){
 	Automate * suffixe = copier_automate(automate);
-	Ensemble * finaux = suffixe->finaux;
-	Ensemble_iterateur it1, it2;
-	int etat_actuel, est_ok;
-	
-	est_ok = 0;
-	
-	for (it1 = premier_iterateur_ensemble(get_etats(suffixe)); ! iterateur_ensemble_est_vide(it1); it1 = iterateur_suivant_ensemble(it1)){
-			
-		etat_actuel = get_element(it1);
-		for (it2 = premier_iterateur_ensemble(finaux); !iterateur_ensemble_est_vide(it2) && !est_ok; it2 = iterateur_suivant_ensemble(it2)){
-			
-			if (est_dans_l_ensemble(etats_accessibles(suffixe, etat_actuel), get_element(it2))) {
-
-				est_ok = 1;
-				ajouter_etat_initial(suffixe, etat_actuel);
-			}
-		}
-		
-		est_ok = 0;
-	}
-	
+	Ensemble * co_accessibles = etats_co_accessibles( automate, automate->finaux );
+	ajouter_elements( suffixe->initiaux, co_accessibles );
+	liberer_ensemble( co_accessibles );
 	return suffixe;
 }
 
 Automate * creer_automate_des_facteurs( const Automate* automate ){
 	Automate * facteur = copier_automate(automate);
-	Ensemble * finaux = facteur->finaux;
-	Ensemble_iterateur it1, it2;
-	int etat_actuel, est_ok;
-	
-	est_ok = 0;
-	
-	for (it1 = premier_iterateur_ensemble(get_etats(facteur)); ! iterateur_ensemble_est_vide(it1); it1 = iterateur_suivant_ensemble(it1)){
-			
-		etat_actuel = get_element(it1);
-		for (it2 = premier_iterateur_ensemble(finaux); !iterateur_ensemble_est_vide(it2) && !est_ok; it2 = iterateur_suivant_ensemble(it2)){
-			
-			if (est_dans_l_ensemble(etats_accessibles(facteur, etat_actuel), get_element(it2))) {
-
-				est_ok = 1;
-				ajouter_etat_initial(facteur, etat_actuel);
-				ajouter_etat_final(facteur, etat_actuel);
-			}
-		}
-		
-		est_ok = 0;
-	}
-	
+	Ensemble * co_accessibles = etats_co_accessibles( automate, automate->finaux );
+	ajouter_elements( facteur->initiaux, co_accessibles );
+	ajouter_elements( facteur->finaux, co_accessibles );
+	liberer_ensemble( co_accessibles );
 	return facteur;
 }
 
@@ -635,8 +1383,8 @@ Automate * creer_automate_des_sur_mot(
 	const Automate* automate, Ensemble * alphabet
 ){
 	Automate* surmots = creer_automate();
-	Ensemble_iterateur it_al;
-	Table_iterateur it_trans;
+	Ensemble_curseur it_al;
+	Table_curseur it_trans;
 	int etat_act = get_max_etat(automate) + 1;
 	int etat_init = get_min_etat(automate) - 1;
 
@@ -644,18 +1392,18 @@ Automate * creer_automate_des_sur_mot(
 	surmots->alphabet = (alphabet != NULL)? creer_union_ensemble(automate->alphabet, alphabet):copier_ensemble(automate->alphabet);
 	
 	// Pour chaques transition, on ajoute un état intermédiaire qui boucle sur lui même avec tout l'alphabet. En epsilon transition il passe à l'état suivant.
-	for (it_trans = premier_iterateur_table(automate->transitions); !iterateur_est_vide(it_trans); it_trans = iterateur_suivant_table(it_trans)) {
+	for (placer_curseur_table( &it_trans, automate->transitions ); !curseur_table_est_vide( &it_trans ); avancer_curseur_table( &it_trans )) {
 		
-		Cle * cle = (Cle*) get_cle(it_trans);
-		Ensemble * fins = (Ensemble*) get_valeur(it_trans);
+		Cle * cle = (Cle*) cle_du_curseur_table( &it_trans );
+		Ensemble * fins = (Ensemble*) valeur_du_curseur_table( &it_trans );
 		
 		ajouter_transition(surmots, cle->origine, cle->lettre, etat_act);
 		
-		for (it_al = premier_iterateur_ensemble(surmots->alphabet); !iterateur_ensemble_est_vide(it_al); it_al = iterateur_suivant_ensemble(it_al))
-			ajouter_transition(surmots, etat_act, get_element(it_al), etat_act);
+		for (placer_curseur_ensemble( &it_al, surmots->alphabet ); !curseur_ensemble_est_vide( &it_al ); avancer_curseur_ensemble( &it_al ))
+			ajouter_transition(surmots, etat_act, element_du_curseur( &it_al ), etat_act);
 		
-		for (it_al = premier_iterateur_ensemble(fins); !iterateur_ensemble_est_vide(it_al); it_al = iterateur_suivant_ensemble(it_al))
-			ajouter_epsilon_transition(surmots, etat_act, get_element(it_al));
+		for (placer_curseur_ensemble( &it_al, fins ); !curseur_ensemble_est_vide( &it_al ); avancer_curseur_ensemble( &it_al ))
+			ajouter_epsilon_transition(surmots, etat_act, element_du_curseur( &it_al ));
 		
 		etat_act++;
 	}
@@ -664,17 +1412,17 @@ Automate * creer_automate_des_sur_mot(
 	ajouter_etat_final(surmots, etat_act);
 	ajouter_etat_initial(surmots, etat_init);
 	
-	for (it_al = premier_iterateur_ensemble(surmots->alphabet); !iterateur_ensemble_est_vide(it_al); it_al = iterateur_suivant_ensemble(it_al)) {
+	for (placer_curseur_ensemble( &it_al, surmots->alphabet ); !curseur_ensemble_est_vide( &it_al ); avancer_curseur_ensemble( &it_al )) {
 		
-		ajouter_transition(surmots, etat_act, get_element(it_al), etat_act);
-		ajouter_transition(surmots, etat_init, get_element(it_al), etat_init);
+		ajouter_transition(surmots, etat_act, element_du_curseur( &it_al ), etat_act);
+		ajouter_transition(surmots, etat_init, element_du_curseur( &it_al ), etat_init);
 	}
 	
 	// Les anciens états initiaux/finaux viennent/vont sur les nouvaux.
-	for (it_al = premier_iterateur_ensemble(automate->initiaux); !iterateur_ensemble_est_vide(it_al); it_al = iterateur_suivant_ensemble(it_al))
-		ajouter_epsilon_transition(surmots, etat_init, get_element(it_al));
-	for (it_al = premier_iterateur_ensemble(automate->finaux); !iterateur_ensemble_est_vide(it_al); it_al = iterateur_suivant_ensemble(it_al))
-		ajouter_epsilon_transition(surmots, get_element(it_al), etat_act);;
+	for (placer_curseur_ensemble( &it_al, automate->initiaux ); !curseur_ensemble_est_vide( &it_al ); avancer_curseur_ensemble( &it_al ))
+		ajouter_epsilon_transition(surmots, etat_init, element_du_curseur( &it_al ));
+	for (placer_curseur_ensemble( &it_al, automate->finaux ); !curseur_ensemble_est_vide( &it_al ); avancer_curseur_ensemble( &it_al ))
+		ajouter_epsilon_transition(surmots, element_du_curseur( &it_al ), etat_act);;
 
 	return surmots;
 }
@@ -710,52 +1458,51 @@ Automate * creer_automate_de_concatenation(
 	/**
 	 * Pour chaque état initial du second automate
 	 */
-	 Ensemble_iterateur initial2;
+	 Ensemble_curseur initial2;
 	 for(
-	 	initial2 = premier_iterateur_ensemble(get_initiaux(automate2));
-	 	! iterateur_ensemble_est_vide( initial2 );
-	 	initial2 = iterateur_suivant_ensemble( initial2 )){
+	 	placer_curseur_ensemble( &initial2, get_initiaux(automate2) );
+	 	! curseur_ensemble_est_vide( &initial2 );
+	 	avancer_curseur_ensemble( &initial2 )){
 		/**
 		 * Pour chaque lettre de son alphabet
 		 */
-		 Ensemble_iterateur lettre;
+		 Ensemble_curseur lettre;
 		 for(
-		 	lettre = premier_iterateur_ensemble(get_alphabet(automate2));
-		 	! iterateur_ensemble_est_vide(lettre);
-		 	lettre = iterateur_suivant_ensemble(lettre)){
+		 	placer_curseur_ensemble( &lettre, get_alphabet(automate2) );
+		 	! curseur_ensemble_est_vide( &lettre );
+		 	avancer_curseur_ensemble( &lettre )){
 
 		 	Cle cle;
-		 	printf("initial2 : %d\n", (int) get_element(initial2));
-		 	printf("lettre : %c\n", (char) get_element(lettre));
-		 	initialiser_cle(&cle, (int) get_element(initial2), (char) get_element(lettre));
-		 	Table_iterateur destination = trouver_table(automate2->transitions, (intptr_t) &cle);
+		 	printf("initial2 : %d\n", (int) element_du_curseur( &initial2 ));
+		 	printf("lettre : %c\n", (char) element_du_curseur( &lettre ));
+		 	initialiser_cle(&cle, (int) element_du_curseur( &initial2 ), (char) element_du_curseur( &lettre ));
+		 	Ensemble* destinations = transitions_depuis(automate2, cle.origine, cle.lettre);
 		 	printf("avant clé\n");
 		 	print_cle(&cle);
 		 	printf("après clé\n");
-		 	if (!iterateur_est_vide(destination)){
+		 	if (destinations){
 		 		AutomateTransition* modif_trans = creer_automate_transition();
 		 		modif_trans->automate = concat;
-		 		modif_trans->lettre = get_element(lettre);
+		 		modif_trans->lettre = element_du_curseur( &lettre );
 
-		 		Ensemble* destinations = (Ensemble*) get_valeur(destination);
-		 		Ensemble_iterateur etat_dest;
+		 		Ensemble_curseur etat_dest;
 				/**
 				 * Pour chaque transition de la forme (i2, a2, q2), avec i2 intial, a2 lettre de l'alphabet
 				 * et q2 état de l'automate2
 				 */
 				for(
-				 	etat_dest = premier_iterateur_ensemble(destinations);
-				 	! iterateur_ensemble_est_vide(etat_dest);
-				 	etat_dest = iterateur_suivant_ensemble(etat_dest)){
-				 	modif_trans->destination = get_element(etat_dest)+decalage;
+				 	placer_curseur_ensemble( &etat_dest, destinations );
+				 	! curseur_ensemble_est_vide( &etat_dest );
+				 	avancer_curseur_ensemble( &etat_dest )){
+				 	modif_trans->destination = element_du_curseur( &etat_dest )+decalage;
 					/**
 					 * On ajoute une transition dans l'automate de concaténation ayant pour origine
 					 * un état initial, la lettre a2 et l'état q2
 					 */
 					 pour_tout_element(get_finaux(automate1), simuler_epsilon_transition, modif_trans);
 				}
-				initialiser_cle(&cle, (int) get_element(initial2) + decalage, get_element(lettre));
-		 		delete_table(concat->transitions, (intptr_t) &cle);
+				initialiser_cle(&cle, (int) element_du_curseur( &initial2 ) + decalage, element_du_curseur( &lettre ));
+		 		retirer_transitions(concat, cle.origine, cle.lettre);
 		 		liberer_automate_transition(modif_trans);
 			}
 		}
@@ -783,42 +1530,414 @@ void simuler_epsilon_transition(const intptr_t element, void* data){
 // Donc si abac est reconnu par automate on doit pouvoir reconnaitre a, b, c, ab, aa, ac, ba, bc, aba, abc, aac, bac, abac
 // Autrement dit, on doit pouvoir aller depuis un état à n'importe quel autre état en _avant_, tout en pouvant commencer partout.
 // C'est donc l'automate des facteurs avec des epsilons transition en plus.
+/*
+ * Matrice d'accessibilité entre les états d'un automate, rangée par lignes 
+ * de bits : l'état etats[j] est accessible depuis l'état etats[i] si le bit
+ * j de la ligne i est à 1. La ligne i occupe les mots 
+ * bits[ i*nb_mots ], ..., bits[ (i+1)*nb_mots - 1 ].
+ */
+typedef struct {
+	intptr_t * etats;
+	size_t nb;
+	size_t nb_mots;
+	unsigned long * bits;
+} Matrice_accessibilite;
+
+/*
+ * Renvoie l'indice de l'état dans le tableau 'etats', trié par ordre 
+ * croissant, qui doit le contenir.
+ */
+size_t rang_etat( const intptr_t * etats, size_t nb, int etat ){
+	size_t debut = 0;
+	size_t fin = nb;
+	while( fin - debut > 1 ){
+		size_t milieu = ( debut + fin ) / 2;
+		if( etats[ milieu ] <= etat ){
+			debut = milieu;
+		}else{
+			fin = milieu;
+		}
+	}
+	return debut;
+}
+
+size_t indice_etat( const Matrice_accessibilite * matrice, int etat ){
+	return rang_etat( matrice->etats, matrice->nb, etat );
+}
+
+unsigned long * ligne_de_matrice( const Matrice_accessibilite * matrice, size_t i ){
+	return matrice->bits + i * matrice->nb_mots;
+}
+
+void ajouter_etat_au_tableau( const intptr_t element, void* data ){
+	Matrice_accessibilite * matrice = (Matrice_accessibilite *) data;
+	matrice->etats[ matrice->nb++ ] = element;
+}
+
+void marquer_transition( int origine, char lettre, int fin, void* data ){
+	Matrice_accessibilite * matrice = (Matrice_accessibilite *) data;
+	size_t j = indice_etat( matrice, fin );
+	ligne_de_matrice( matrice, indice_etat( matrice, origine ) )[ j / BITS_PAR_MOT ]
+		|= 1UL << ( j % BITS_PAR_MOT );
+}
+
+void marquer_epsilon_transition( int origine, int fin, void* data ){
+	marquer_transition( origine, 0, fin, data );
+}
+
+/*
+ * Calcule la matrice des couples (p, q) tels que q est accessible depuis p 
+ * en lisant un mot non vide (ou en suivant au moins une ε-transition).
+ *
+ * La matrice des transitions est fermée par l'algorithme de Warshall : 
+ * quand q est accessible depuis p, tous les états accessibles depuis q le 
+ * sont depuis p, et la ligne de q est ajoutée à celle de p un mot machine 
+ * à la fois. Le calcul prend O( n^3 / BITS_PAR_MOT ) opérations sur n 
+ * états.
+ */
+void calculer_accessibilite( 
+	Matrice_accessibilite * matrice, const Automate * automate 
+){
+	size_t n = taille_ensemble( automate->etats );
+	matrice->etats = xmalloc( ( n + 1 ) * sizeof( intptr_t ) );
+	matrice->nb = 0;
+	pour_tout_element( automate->etats, ajouter_etat_au_tableau, matrice );
+	matrice->nb_mots = ( n + BITS_PAR_MOT - 1 ) / BITS_PAR_MOT;
+	size_t taille = ( n * matrice->nb_mots + 1 ) * sizeof( unsigned long );
+	matrice->bits = xmalloc( taille );
+	memset( matrice->bits, 0, taille );
+	pour_toute_transition( automate, marquer_transition, matrice );
+	pour_toute_epsilon_transition( automate, marquer_epsilon_transition, matrice );
+
+	size_t i, k, m;
+	for( k=0; k<n; k++ ){
+		const unsigned long * ligne_k = ligne_de_matrice( matrice, k );
+		unsigned long bit_k = 1UL << ( k % BITS_PAR_MOT );
+		for( i=0; i<n; i++ ){
+			unsigned long * ligne_i = ligne_de_matrice( matrice, i );
+			if( ligne_i[ k / BITS_PAR_MOT ] & bit_k ){
+				for( m=0; m<matrice->nb_mots; m++ ){
+					ligne_i[m] |= ligne_k[m];
+				}
+			}
+		}
+	}
+}
+
+void liberer_matrice_accessibilite( Matrice_accessibilite * matrice ){
+	xfree( matrice->etats );
+	xfree( matrice->bits );
+}
+
+/**
+ * \par Implémentation
+ * Les ε-transitions ajoutées relient chaque état aux états qui en sont 
+ * accessibles. Elles sont lues sur la matrice d'accessibilité (voir 
+ * calculer_accessibilite()), et celles d'un même état sont ajoutées d'un 
+ * seul coup, déjà triées. Un état depuis lequel un état final est 
+ * accessible devient initial et final.
+ */
 Automate * creer_automate_des_sous_mots( const Automate* automate ){
 	Automate * sous_mots = copier_automate(automate);
-	Ensemble * finaux = sous_mots->finaux;
-	Ensemble_iterateur it1, it2;
-	int etat_actuel, etat_cible;
-	
-	for (it1 = premier_iterateur_ensemble(get_etats(sous_mots)); ! iterateur_ensemble_est_vide(it1); it1 = iterateur_suivant_ensemble(it1)){
-			
-		etat_actuel = get_element(it1);
-		for (it2 = premier_iterateur_ensemble(etats_accessibles(sous_mots, etat_actuel)); !iterateur_ensemble_est_vide(it2); it2 = iterateur_suivant_ensemble(it2)){
-		
-			etat_cible = get_element(it2);
-			ajouter_epsilon_transition(sous_mots, etat_actuel, etat_cible); 
-			
-			if (est_dans_l_ensemble(finaux, etat_cible)) {
+	Matrice_accessibilite matrice;
+	calculer_accessibilite( &matrice, automate );
+	size_t n = matrice.nb;
+
+	// Les états finaux, sous la forme d'une ligne de la matrice.
+	unsigned long * finaux = xmalloc( ( matrice.nb_mots + 1 ) * sizeof( unsigned long ) );
+	memset( finaux, 0, ( matrice.nb_mots + 1 ) * sizeof( unsigned long ) );
+	size_t i, j, m;
+	for( j=0; j<n; j++ ){
+		if( est_dans_l_ensemble( automate->finaux, matrice.etats[j] ) ){
+			finaux[ j / BITS_PAR_MOT ] |= 1UL << ( j % BITS_PAR_MOT );
+		}
+	}
 
-				ajouter_etat_initial(sous_mots, etat_actuel);
-				ajouter_etat_final(sous_mots, etat_actuel);
+	intptr_t * fins = xmalloc( ( n + 1 ) * sizeof( intptr_t ) );
+	intptr_t * extremites = xmalloc( ( n + 1 ) * sizeof( intptr_t ) );
+	unsigned int nb_extremites = 0;
+	for( i=0; i<n; i++ ){
+		const unsigned long * ligne = ligne_de_matrice( &matrice, i );
+		unsigned int nb_fins = 0;
+		for( j=0; j<n; j++ ){
+			if( ligne[ j / BITS_PAR_MOT ] & ( 1UL << ( j % BITS_PAR_MOT ) ) ){
+				fins[ nb_fins++ ] = matrice.etats[j];
+			}
+		}
+		ajouter_epsilon_transitions_triees( 
+			sous_mots, matrice.etats[i], fins, nb_fins 
+		);
+		for( m=0; m<matrice.nb_mots; m++ ){
+			if( ligne[m] & finaux[m] ){
+				extremites[ nb_extremites++ ] = matrice.etats[i];
+				break;
 			}
 		}
 	}
-	
+
+	Ensemble * nouvelles_extremites = creer_ensemble_depuis_tableau_trie(
+		NULL, NULL, NULL, extremites, nb_extremites
+	);
+	ajouter_elements( sous_mots->initiaux, nouvelles_extremites );
+	ajouter_elements( sous_mots->finaux, nouvelles_extremites );
+	liberer_ensemble( nouvelles_extremites );
+
+	xfree( extremites );
+	xfree( fins );
+	xfree( finaux );
+	liberer_matrice_accessibilite( &matrice );
 	return sous_mots;
 }
 
-int comparer_int(const int a, const int b) {
-	if (a>b) return 1;
-	if (a<b) return -1;
-	return 0;
+/*
+ * Composantes fortement connexes du graphe des ε-transitions d'un automate,
+ * calculées par l'algorithme de Tarjan.
+ *
+ * Les sommets sont les états de l'automate, repérés par leur rang dans le 
+ * tableau trié 'etats'. Les composantes sont numérotées dans l'ordre où 
+ * l'algorithme les termine : les ε-transitions qui sortent d'une composante
+ * ne mènent qu'à elle-même ou à des composantes de numéro plus petit. 
+ * clotures[c] est l'ε-clôture commune à tous les états de la composante c.
+ */
+typedef struct {
+	const Automate * automate;
+	intptr_t * etats;
+	size_t nb;
+	size_t * numeros;
+	size_t * remontees;
+	size_t * composantes;
+	size_t nb_composantes;
+	Ensemble ** clotures;
+	size_t * pile;
+	size_t hauteur_pile;
+} Composantes_epsilon;
+
+/*
+ * Un appel en cours du parcours en profondeur : un sommet et la position
+ * dans l'ensemble de ses ε-voisins.
+ */
+typedef struct {
+	size_t sommet;
+	Ensemble_curseur it;
+} Appel_tarjan;
+
+#define PAS_DE_COMPOSANTE ( (size_t) -1 )
+
+void ajouter_etat_aux_composantes( const intptr_t element, void* data ){
+	Composantes_epsilon * composantes = (Composantes_epsilon *) data;
+	composantes->etats[ composantes->nb++ ] = element;
 }
-int copier_int(const int a) {
-	return a;
+
+/*
+ * Termine la composante dont 'racine' est le premier sommet visité : ses 
+ * sommets sont dépilés, et sa clôture est l'union de ses sommets et des 
+ * clôtures des composantes atteintes par une ε-transition, qui sont toutes
+ * déjà terminées.
+ */
+void terminer_composante( Composantes_epsilon * composantes, size_t racine ){
+	size_t c = composantes->nb_composantes++;
+	size_t debut = composantes->hauteur_pile;
+	do {
+		debut--;
+		composantes->composantes[ composantes->pile[ debut ] ] = c;
+	} while( composantes->pile[ debut ] != racine );
+
+	Ensemble * cloture = creer_ensemble( NULL, NULL, NULL );
+	size_t i;
+	Ensemble_curseur it;
+	for( i = debut; i < composantes->hauteur_pile; i++ ){
+		size_t sommet = composantes->pile[i];
+		ajouter_element( cloture, composantes->etats[ sommet ] );
+		for(
+			placer_curseur_ensemble( 
+				&it, epsilon_voisins( 
+					composantes->automate, composantes->etats[ sommet ] 
+				)
+			);
+			! curseur_ensemble_est_vide( &it );
+			avancer_curseur_ensemble( &it )
+		){
+			size_t voisin = rang_etat( 
+				composantes->etats, composantes->nb, element_du_curseur( &it ) 
+			);
+			size_t d = composantes->composantes[ voisin ];
+			if( d != c ){
+				union_dans( cloture, composantes->clotures[d] );
+			}
+		}
+	}
+	composantes->clotures[c] = cloture;
+	composantes->hauteur_pile = debut;
 }
-void supprimer_int(const int a) {
-	return;
+
+/*
+ * Parcours en profondeur de Tarjan depuis le sommet 'depart', avec une pile
+ * d'appels explicite.
+ */
+void visiter_tarjan( 
+	Composantes_epsilon * composantes, Appel_tarjan * appels, size_t depart,
+	size_t * compteur
+){
+	size_t nb_appels = 0;
+	appels[ nb_appels ].sommet = depart;
+	placer_curseur_ensemble( 
+		&appels[ nb_appels ].it,
+		epsilon_voisins( composantes->automate, composantes->etats[ depart ] )
+	);
+	nb_appels++;
+	composantes->numeros[ depart ] = composantes->remontees[ depart ] = ++(*compteur);
+	composantes->pile[ composantes->hauteur_pile++ ] = depart;
+
+	while( nb_appels > 0 ){
+		Appel_tarjan * appel = &appels[ nb_appels - 1 ];
+		size_t sommet = appel->sommet;
+		if( ! curseur_ensemble_est_vide( &appel->it ) ){
+			size_t voisin = rang_etat( 
+				composantes->etats, composantes->nb, 
+				element_du_curseur( &appel->it ) 
+			);
+			avancer_curseur_ensemble( &appel->it );
+			if( composantes->numeros[ voisin ] == 0 ){
+				composantes->numeros[ voisin ] = ++(*compteur);
+				composantes->remontees[ voisin ] = composantes->numeros[ voisin ];
+				composantes->pile[ composantes->hauteur_pile++ ] = voisin;
+				appels[ nb_appels ].sommet = voisin;
+				placer_curseur_ensemble( 
+					&appels[ nb_appels ].it,
+					epsilon_voisins( 
+						composantes->automate, composantes->etats[ voisin ] 
+					)
+				);
+				nb_appels++;
+			}else if( composantes->composantes[ voisin ] == PAS_DE_COMPOSANTE ){
+				// Le voisin est encore sur la pile : il est dans la 
+				// composante en cours.
+				if( composantes->numeros[ voisin ] < composantes->remontees[ sommet ] ){
+					composantes->remontees[ sommet ] = composantes->numeros[ voisin ];
+				}
+			}
+			continue;
+		}
+		if( composantes->remontees[ sommet ] == composantes->numeros[ sommet ] ){
+			terminer_composante( composantes, sommet );
+		}
+		nb_appels--;
+		if( nb_appels > 0 ){
+			size_t parent = appels[ nb_appels - 1 ].sommet;
+			if( composantes->remontees[ sommet ] < composantes->remontees[ parent ] ){
+				composantes->remontees[ parent ] = composantes->remontees[ sommet ];
+			}
+		}
+	}
 }
+
+void calculer_composantes_epsilon( 
+	Composantes_epsilon * composantes, const Automate * automate 
+){
+	size_t n = taille_ensemble( automate->etats );
+	composantes->automate = automate;
+	composantes->etats = xmalloc( ( n + 1 ) * sizeof( intptr_t ) );
+	composantes->nb = 0;
+	pour_tout_element( automate->etats, ajouter_etat_aux_composantes, composantes );
+	composantes->numeros = xmalloc( ( n + 1 ) * sizeof( size_t ) );
+	composantes->remontees = xmalloc( ( n + 1 ) * sizeof( size_t ) );
+	composantes->composantes = xmalloc( ( n + 1 ) * sizeof( size_t ) );
+	composantes->clotures = xmalloc( ( n + 1 ) * sizeof( Ensemble * ) );
+	composantes->pile = xmalloc( ( n + 1 ) * sizeof( size_t ) );
+	composantes->nb_composantes = 0;
+	composantes->hauteur_pile = 0;
+	size_t i;
+	for( i=0; i<n; i++ ){
+		composantes->numeros[i] = 0;
+		composantes->composantes[i] = PAS_DE_COMPOSANTE;
+	}
+
+	Appel_tarjan * appels = xmalloc( ( n + 1 ) * sizeof( Appel_tarjan ) );
+	size_t compteur = 0;
+	for( i=0; i<n; i++ ){
+		if( composantes->numeros[i] == 0 ){
+			visiter_tarjan( composantes, appels, i, &compteur );
+		}
+	}
+	xfree( appels );
+}
+
+void liberer_composantes_epsilon( Composantes_epsilon * composantes ){
+	size_t c;
+	for( c=0; c<composantes->nb_composantes; c++ ){
+		liberer_ensemble( composantes->clotures[c] );
+	}
+	xfree( composantes->etats );
+	xfree( composantes->numeros );
+	xfree( composantes->remontees );
+	xfree( composantes->composantes );
+	xfree( composantes->clotures );
+	xfree( composantes->pile );
+}
+
+/**
+ * \par Implémentation
+ * Les ε-clôtures sont calculées une seule fois par composante fortement 
+ * connexe du graphe des ε-transitions (voir calculer_composantes_epsilon()).
+ * Chaque état p reçoit ensuite les transitions (p, a, r) pour toutes les 
+ * transitions (q, a, r) partant d'un état q de sa clôture, et devient final
+ * si sa clôture contient un état final. Les états qui ne sont plus 
+ * accessibles sans ε-transition sont retirés.
+ */
+Automate * creer_automate_sans_epsilon( const Automate* automate ){
+	if( ! a_des_epsilon_transitions( automate ) ){
+		return copier_automate( automate );
+	}
+	Composantes_epsilon composantes;
+	calculer_composantes_epsilon( &composantes, automate );
+
+	Automate * res = creer_automate();
+	ajouter_elements( res->alphabet, automate->alphabet );
+	ajouter_etats( res, automate->etats );
+	ajouter_elements( res->initiaux, automate->initiaux );
+
+	size_t i, j;
+	Ensemble_curseur it, it_fin;
+	for( i=0; i<composantes.nb; i++ ){
+		int origine = composantes.etats[i];
+		const Ensemble * cloture = 
+			composantes.clotures[ composantes.composantes[i] ];
+		for(
+			placer_curseur_ensemble( &it, cloture );
+			! curseur_ensemble_est_vide( &it );
+			avancer_curseur_ensemble( &it )
+		){
+			int etat = element_du_curseur( &it );
+			if( est_dans_l_ensemble( automate->finaux, etat ) ){
+				ajouter_element( res->finaux, origine );
+			}
+			const Ligne_transitions * ligne = ligne_de( automate, etat );
+			if( ! ligne ) continue;
+			for( j=0; j<ligne->nb; j++ ){
+				for(
+					placer_curseur_ensemble( &it_fin, ligne->valeurs[j] );
+					! curseur_ensemble_est_vide( &it_fin );
+					avancer_curseur_ensemble( &it_fin )
+				){
+					ajouter_transition( 
+						res, origine, ligne->cles[j], element_du_curseur( &it_fin )
+					);
+				}
+			}
+		}
+	}
+	liberer_composantes_epsilon( &composantes );
+
+	Ensemble * accessibles = etats_accessibles_depuis_initiaux( res );
+	if( taille_ensemble( accessibles ) < taille_ensemble( res->etats ) ){
+		Automate * compact = restreindre_automate( res, accessibles );
+		liberer_automate( res );
+		res = compact;
+	}
+	liberer_ensemble( accessibles );
+	return res;
+}
+
 // À chaque itération de l'algo, on prend une lettre du premier ou du second automate, jusqu'à ce qu'on arrive à la dernière lettre.
 // Produit cartésien des états.
 // Exemple : mot 1 : aaaa, mot 2 : bbbb
@@ -829,18 +1948,12 @@ Automate * creer_automate_du_melange(
 	int i, j, k, nbelau1, nbelau2, etat_act, et1, et2;
 	int ** nouveaux_etats = NULL;
 	Automate * melange = creer_automate();
-	Ensemble_iterateur it1, it2;
-	Table_iterateur it_transition;
-	Table *cle1 = creer_table(
-		( int(*)(const intptr_t, const intptr_t) ) comparer_int , 
-		( intptr_t (*)( const intptr_t ) ) copier_int,
-		( void(*)(intptr_t) ) supprimer_int
-	);
-	Table *cle2 = creer_table(
-		( int(*)(const intptr_t, const intptr_t) ) comparer_int , 
-		( intptr_t (*)( const intptr_t ) ) copier_int,
-		( void(*)(intptr_t) ) supprimer_int
-	);
+	Ensemble_curseur it1, it2;
+	Table_curseur it_transition;
+	// Ces tables ne servent qu'à retrouver l'indice d'un état : des tables de 
+	// hachage suffisent.
+	Table *cle1 = creer_table_hachage( NULL, NULL, NULL, NULL );
+	Table *cle2 = creer_table_hachage( NULL, NULL, NULL, NULL );
 	const Ensemble * finaux1 = get_finaux(automate1); const Ensemble * finaux2 = get_finaux(automate2);
 	const Ensemble * initiaux1 = get_initiaux(automate1); const Ensemble * initiaux2 = get_initiaux(automate2);
 	
@@ -852,13 +1965,13 @@ Automate * creer_automate_du_melange(
 	k = 0;
 	
 	// Création des états, états initiaux, états finaux de l'automate.
-	for (it1 = premier_iterateur_ensemble(automate1->etats), i=0; ! iterateur_ensemble_est_vide(it1); it1 = iterateur_suivant_ensemble(it1), i++){
+	for (placer_curseur_ensemble( &it1, automate1->etats ), i=0; ! curseur_ensemble_est_vide( &it1 ); avancer_curseur_ensemble( &it1 ), i++){
 		
-		et1 = get_element(it1);
+		et1 = element_du_curseur( &it1 );
 		add_table(cle1, et1, i);
-		for (it2 = premier_iterateur_ensemble(automate2->etats), j=0; ! iterateur_ensemble_est_vide(it2); it2 = iterateur_suivant_ensemble(it2), j++){
+		for (placer_curseur_ensemble( &it2, automate2->etats ), j=0; ! curseur_ensemble_est_vide( &it2 ); avancer_curseur_ensemble( &it2 ), j++){
 			
-			et2 = get_element(it2);
+			et2 = element_du_curseur( &it2 );
 			ajouter_etat(melange, k);
 			add_table(cle2, et2, j);
 			if (est_dans_l_ensemble(finaux1, et1) && est_dans_l_ensemble(finaux2, et2))
@@ -874,39 +1987,43 @@ Automate * creer_automate_du_melange(
 	
 	// Les transitions sont ensuite crées
 	// D'abord celles de l'ancien automate 1
-	for (it_transition = premier_iterateur_table(automate1->transitions); !iterateur_est_vide(it_transition); it_transition = iterateur_suivant_table(it_transition)) {
+	for (placer_curseur_table( &it_transition, automate1->transitions ); !curseur_table_est_vide( &it_transition ); avancer_curseur_table( &it_transition )) {
 		
-		Cle * cle = (Cle*) get_cle(it_transition);
-		Ensemble * fins = (Ensemble*) get_valeur(it_transition);
+		Cle * cle = (Cle*) cle_du_curseur_table( &it_transition );
+		Ensemble * fins = (Ensemble*) valeur_du_curseur_table( &it_transition );
 
-		for (it1 = premier_iterateur_ensemble(fins), i=0; ! iterateur_ensemble_est_vide(it1); it1 = iterateur_suivant_ensemble(it1), i++){
+		for (placer_curseur_ensemble( &it1, fins ), i=0; ! curseur_ensemble_est_vide( &it1 ); avancer_curseur_ensemble( &it1 ), i++){
 			
-			etat_act = get_element(it1);
+			etat_act = element_du_curseur( &it1 );
+			int origine = (int) *chercher_valeur_table( cle1, cle->origine );
+			int fin = (int) *chercher_valeur_table( cle1, etat_act );
 			for(i = 0; i < nbelau2; i++) {
 
 				ajouter_transition(melange,
-					nouveaux_etats[(int)get_valeur(trouver_table(cle1, cle->origine))][i],
+					nouveaux_etats[origine][i],
 					cle->lettre,
-					nouveaux_etats[(int)get_valeur(trouver_table(cle1, etat_act))][i]);
+					nouveaux_etats[fin][i]);
 			}
 		}
 	}
 	
 	// Puis celles de l'ancien automate 2
-	for (it_transition = premier_iterateur_table(automate2->transitions); !iterateur_est_vide(it_transition); it_transition = iterateur_suivant_table(it_transition)) {
+	for (placer_curseur_table( &it_transition, automate2->transitions ); !curseur_table_est_vide( &it_transition ); avancer_curseur_table( &it_transition )) {
 		
-		Cle * cle = (Cle*) get_cle(it_transition);
-		Ensemble * fins = (Ensemble*) get_valeur(it_transition);
+		Cle * cle = (Cle*) cle_du_curseur_table( &it_transition );
+		Ensemble * fins = (Ensemble*) valeur_du_curseur_table( &it_transition );
 
-		for (it1 = premier_iterateur_ensemble(fins), i=0; ! iterateur_ensemble_est_vide(it1); it1 = iterateur_suivant_ensemble(it1), i++){
+		for (placer_curseur_ensemble( &it1, fins ), i=0; ! curseur_ensemble_est_vide( &it1 ); avancer_curseur_ensemble( &it1 ), i++){
 			
-			etat_act = get_element(it1);
+			etat_act = element_du_curseur( &it1 );
+			int origine = (int) *chercher_valeur_table( cle2, cle->origine );
+			int fin = (int) *chercher_valeur_table( cle2, etat_act );
 			for(i = 0; i < nbelau1; i++) {
 
 				ajouter_transition(melange,
-					nouveaux_etats[i][(int)get_valeur(trouver_table(cle2, cle->origine))],
+					nouveaux_etats[i][origine],
 					cle->lettre,
-					nouveaux_etats[i][(int)get_valeur(trouver_table(cle2, etat_act))]);
+					nouveaux_etats[i][fin]);
 			}
 		}
 	}
@@ -963,26 +2080,90 @@ void print_automate( const Automate * automate ){
 		( void (*)( const intptr_t ) ) print_ensemble_2,
 		""
 	);
+	if( a_des_epsilon_transitions( automate ) ){
+		printf("\n- Epsilon transitions : ");
+		print_table( 
+			automate->epsilon, NULL,
+			( void (*)( const intptr_t ) ) print_ensemble_2,
+			""
+		);
+	}
 	printf("\n");
 }
 
-int le_mot_est_reconnu( const Automate* automate, const char* mot ){
-	Ensemble * fins = copier_ensemble(get_initiaux(automate));
-	int i;	
-	for(i = 0; i < strlen(mot); i++)
-	{	
-		fins = delta(automate, fins, mot[i]);		
+/*
+ * Empile l'état dans l'ensemble, avec son ε-clôture si l'automate a des 
+ * ε-transitions. L'ensemble doit ensuite être normalisé.
+ */
+void ajouter_etat_et_cloture( 
+	Ensemble_etats * etats, const Automate* automate, int etat 
+){
+	if( ! a_des_epsilon_transitions( automate ) ){
+		Ensemble_etats_empiler( etats, etat );
+		return;
 	}
+	Ensemble_curseur it;
+	for(
+		placer_curseur_ensemble( &it, epsilon_cloture( automate, etat ) );
+		! curseur_ensemble_est_vide( &it );
+		avancer_curseur_ensemble( &it )
+	){
+		Ensemble_etats_empiler( etats, element_du_curseur( &it ) );
+	}
+}
+
+int le_mot_est_reconnu( const Automate* automate, const char* mot ){
+	// Les ensembles d'états courants ne sortent pas de la fonction : des 
+	// ensembles typés suffisent, et évitent de créer un Ensemble par lettre.
+	Ensemble_etats courants, suivants, tmp;
+	Ensemble_etats_initialiser( &courants );
+	Ensemble_etats_initialiser( &suivants );
 
-	Ensemble_iterateur it1;
+	Ensemble_curseur it;
 	for(
-		it1 = premier_iterateur_ensemble(fins);
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
+		placer_curseur_ensemble( &it, get_initiaux( automate ) );
+		! curseur_ensemble_est_vide( &it );
+		avancer_curseur_ensemble( &it )
 	){
-		if (est_un_etat_final_de_l_automate(automate, get_element(it1)))
-		return 1;		
+		ajouter_etat_et_cloture( &courants, automate, element_du_curseur( &it ) );
+	}
+	Ensemble_etats_normaliser( &courants );
+
+	const char* c;
+	size_t i;
+	for( c = mot; *c && courants.nb > 0; c++ ){
+		Ensemble_etats_vider( &suivants );
+		for( i=0; i<courants.nb; i++ ){
+			const Ensemble * fins = transitions_depuis( 
+				automate, courants.elements[i], *c 
+			);
+			if( ! fins ) continue;
+			for(
+				placer_curseur_ensemble( &it, fins );
+				! curseur_ensemble_est_vide( &it );
+				avancer_curseur_ensemble( &it )
+			){
+				ajouter_etat_et_cloture( 
+					&suivants, automate, element_du_curseur( &it ) 
+				);
+			}
+		}
+		// Les états sont triés et dédoublonnés une seule fois par lettre,
+		// comme dans calculer_successeur() : un ajout trié à chaque état 
+		// coûterait un temps quadratique.
+		Ensemble_etats_normaliser( &suivants );
+		tmp = courants;
+		courants = suivants;
+		suivants = tmp;
 	}
 
-	return 0;
+	int reconnu = 0;
+	for( i=0; i<courants.nb && ! reconnu; i++ ){
+		reconnu = est_un_etat_final_de_l_automate( 
+			automate, courants.elements[i] 
+		);
+	}
+	Ensemble_etats_liberer( &courants );
+	Ensemble_etats_liberer( &suivants );
+	return reconnu;
 }
@@ -33,8 +33,9 @@
  * 
  * Ce type code un automate. Cette automate peut être non deterministe, ses 
  * états sont des entiers codés par le 
- * type int. Les lettres sont codées par le type char, et l'automate n'accepte 
- * pas d'epsilon transition.
+ * type int. Les lettres sont codées par le type char. Les epsilon transitions
+ * sont rangées à part : epsilon n'est pas une lettre de l'alphabet, et tous 
+ * les caractères, '#' compris, peuvent servir de lettres.
  * L'automate codé, peut avoir plusieurs états initiaux.
  * 
  */
@@ -89,8 +90,8 @@ void ajouter_transition(
 /**
  * \brief Ajoute une epsilon transition à l'automate passé en paramètre.
  *
- *  Alias pour centraliser la définition de la lettre codant Epsilon
- *  Appelle ajouter_transition
+ * Si les états de la transition n'existent pas dans l'automate, ils sont 
+ * ajoutés automatiquement à l'automate. L'alphabet n'est pas modifié.
  *
  * \param automate Un automate
  * \param origine L'origine de la transition
@@ -236,6 +237,24 @@ Ensemble * delta1(
 	const Automate* automate, int origine, char lettre
 );
 
+/**
+ * \brief Renvoie l'ensemble des états accessibles à partir d'un état en
+ *        lisant une lettre, sans le recopier.
+ *
+ * Contrairement à delta1(), aucun ensemble n'est alloué : l'ensemble
+ * renvoyé appartient à l'automate, et n'est plus valide dès que l'automate
+ * est modifié. La fonction ne modifie pas l'automate : plusieurs threads
+ * peuvent l'appeler en même temps sur un automate qui n'est pas modifié.
+ *
+ * \param automate Un automate
+ * \param origine Un état
+ * \param lettre Une lettre
+ * \return L'ensemble des états accessibles.
+ */
+const Ensemble * voisins(
+	const Automate* automate, int origine, char lettre
+);
+
 /**
  * \brief Renvoie l'ensemble des états accéssibles à partir d'un ensemble 
  *        d'états donné en paramètre et en lisant une lettre donné en 
@@ -276,6 +295,9 @@ Ensemble * delta_star(
  * \brief Renvoie vrai si le mot passé en paramètre est reconu par l'automate 
  *        passé en paramètre, et renvoie 0 sinon.
  *
+ * Les epsilon transitions de l'automate sont suivies. Si l'automate en a, la
+ * fonction n'est pas thread-safe (voir epsilon_cloture()).
+ *
  * \param automate Un automate
  * \param mot Le mot à reconaître
  * \return 1 ou 0
@@ -306,6 +328,132 @@ void pour_toute_transition(
 );
 
 
+/**
+ * \brief Passe en revue toutes les transitions partant de l'état 'origine' et
+ *        appelle la fonction passée en paramètre.
+ *
+ * Les transitions sont parcourues par lettre croissante. Le coût du parcours
+ * est proportionnel au nombre de transitions partant de l'état, et non au 
+ * nombre total de transitions de l'automate.
+ *
+ * \param automate Un automate
+ * \param origine L'état dont on parcourt les transitions sortantes
+ * \param action La fonction à exécuter (voir pour_toute_transition())
+ * \param data La donnée supplémentaire à passer en paramètre à la fonction 
+ *             'action' executée à chaque transition.
+ */ 
+void pour_toute_transition_depuis(
+	const Automate* automate, int origine,
+	void (* action )( int origine, char lettre, int fin, void* data ),
+	void* data
+);
+
+/**
+ * \brief Exécute une action sur toutes les transitions qui arrivent dans un 
+ *        état donné.
+ *
+ * Si l'index des prédécesseurs est actif (voir indexer_predecesseurs()), 
+ * seules ces transitions sont parcourues. Sinon, toutes les transitions de 
+ * l'automate sont examinées.
+ *
+ * \param automate L'automate
+ * \param fin L'état d'arrivée des transitions
+ * \param action La fonction à exécuter (voir pour_toute_transition())
+ * \param data Le paramètre passé à la fonction 'action'
+ */
+void pour_toute_transition_vers(
+	const Automate* automate, int fin,
+	void (* action )( int origine, char lettre, int fin, void* data ),
+	void* data
+);
+
+/**
+ * \brief Exécute une action sur toutes les epsilon transitions d'un 
+ *        automate, par ordre croissant des origines.
+ *
+ * \param automate L'automate
+ * \param action La fonction à exécuter, qui reçoit l'origine et la fin de la 
+ *        transition, et le paramètre 'data'
+ * \param data Le paramètre passé à la fonction 'action'
+ */
+void pour_toute_epsilon_transition(
+	const Automate* automate,
+	void (* action )( int origine, int fin, void* data ),
+	void* data
+);
+
+/**
+ * \brief Renvoie 1 si l'automate a au moins une epsilon transition, 0 sinon.
+ *
+ * \param automate Un automate
+ * \return 1 ou 0
+ */
+int a_des_epsilon_transitions( const Automate* automate );
+
+/**
+ * \brief Renvoie 1 si l'automate a une epsilon transition de 'origine' vers
+ *        'fin', 0 sinon.
+ *
+ * \param automate Un automate
+ * \param origine L'origine de la transition
+ * \param fin La fin de la transition
+ * \return 1 ou 0
+ */
+int est_une_epsilon_transition_de_l_automate(
+	const Automate* automate, int origine, int fin
+);
+
+/**
+ * \brief Renvoie l'ensemble des fins des epsilon transitions d'un état.
+ *
+ * L'ensemble appartient à l'automate : il ne doit être ni modifié, ni libéré.
+ *
+ * \param automate Un automate
+ * \param origine Un état
+ * \return L'ensemble des fins
+ */
+const Ensemble * epsilon_voisins( const Automate* automate, int origine );
+
+/**
+ * \brief Renvoie l'epsilon clôture d'un état : l'ensemble des états 
+ *        accessibles depuis cet état (lui compris) en ne suivant que des 
+ *        epsilon transitions.
+ *
+ * Les clôtures calculées sont gardées par l'automate jusqu'au prochain ajout
+ * d'une epsilon transition : demander plusieurs fois la même clôture ne 
+ * coûte qu'une recherche. L'ensemble renvoyé appartient à l'automate : il ne
+ * doit être ni modifié, ni libéré, et n'est plus valide après l'ajout d'une
+ * epsilon transition.
+ *
+ * Bien que l'automate soit passé 'const', cette fonction modifie les 
+ * clôtures gardées par l'automate : elle n'est pas thread-safe. Plusieurs 
+ * threads ne doivent donc pas l'appeler en même temps sur un même automate,
+ * pas plus que le_mot_est_reconnu(), qui l'utilise si l'automate a des 
+ * epsilon transitions. Pour lire des mots en parallèle, voir 
+ * creer_cache_deterministe().
+ *
+ * \param automate Un automate
+ * \param etat Un état
+ * \return L'epsilon clôture de l'état
+ */
+const Ensemble * epsilon_cloture( const Automate* automate, int etat );
+
+/**
+ * \brief Active l'index des prédécesseurs de l'automate.
+ *
+ * L'index associe à chaque état les transitions qui y arrivent. Il est 
+ * ensuite tenu à jour par ajouter_transition(), et recopié par 
+ * copier_automate(). Les parcours à rebours (pour_toute_transition_vers(),
+ * etats_co_accessibles(), ...) l'utilisent au lieu de reconstruire les 
+ * transitions inversées à chaque appel.
+ *
+ * L'index coûte une place mémoire proportionnelle au nombre de transitions.
+ * Activer un index déjà actif n'a aucun effet.
+ *
+ * \param automate L'automate
+ */
+void indexer_predecesseurs( Automate * automate );
+
 /**
  * \brief Copie un automate.
  *
@@ -335,6 +483,37 @@ Automate * mot_to_automate( const char * mot );
  */ 
 Ensemble* etats_accessibles( const Automate * automate, int etat );
 
+/**
+ * \brief Renvoie l'ensemble des états accessibles à partir d'un ensemble 
+ *        d'états en lisant un mot non vide quelconque.
+ *
+ * Un état de départ ne fait partie du résultat que s'il est accessible 
+ * depuis un état de départ. La fonction est en temps linéaire en le nombre 
+ * d'états et de transitions de l'automate.
+ *
+ * \param automate Un automate
+ * \param departs Les états de départ
+ * \return L'ensemble des états accessibles
+ */ 
+Ensemble* etats_accessibles_depuis(
+	const Automate * automate, const Ensemble * departs
+);
+
+/**
+ * \brief Renvoie l'ensemble des états depuis lesquels on peut atteindre un 
+ *        état d'un ensemble donné en lisant un mot non vide quelconque.
+ *
+ * La fonction est en temps linéaire en le nombre d'états et de transitions 
+ * de l'automate.
+ *
+ * \param automate Un automate
+ * \param arrivees Les états d'arrivée
+ * \return L'ensemble des états co-accessibles
+ */ 
+Ensemble* etats_co_accessibles(
+	const Automate * automate, const Ensemble * arrivees
+);
+
 /**
  * \brief Renvoie l'automate passé en paramètre dont les états non accessible 
  *        ont été supprimés.
@@ -367,6 +546,20 @@ Automate *miroir( const Automate * automate);
  */ 
 Automate *automate_co_accessible( const Automate * automate);
 
+/**
+ * \brief Renvoie l'automate émondé d'un automate, c'est à dire l'automate 
+ *        passé en paramètre dont les états qui ne sont pas à la fois 
+ *        accessibles et co-accessibles ont été supprimés.
+ *
+ * L'automate émondé reconnait le même langage. La fonction est en temps 
+ * linéaire en le nombre d'états et de transitions (à un facteur 
+ * logarithmique près pour la construction du nouvel automate).
+ *
+ * \param automate Un automate
+ * \return L'automate émondé
+ */ 
+Automate *automate_emonde( const Automate * automate);
+
 /**
  * \brief Créer l'automate des préfixes d'un automate.
  *
@@ -437,6 +630,218 @@ Automate * creer_automate_de_concatenation( const Automate* automate1, const Aut
  */ 
 Automate * creer_automate_des_sous_mots( const Automate* automate );
 
+/**
+ * \brief Créer un automate sans epsilon transition qui reconnait le même 
+ *        langage que l'automate passé en paramètre.
+ *
+ * Les états de l'automate créé sont les états de l'automate de départ qui 
+ * restent accessibles sans epsilon transition. Si l'automate de départ n'a 
+ * pas d'epsilon transition, l'automate créé en est une copie.
+ *
+ * \param automate L'automate de départ
+ * \return L'automate à créer
+ */ 
+Automate * creer_automate_sans_epsilon( const Automate* automate );
+
+/**
+ * \brief Créer un automate déterministe qui reconnait le même langage que
+ *        l'automate passé en paramètre (construction des sous-ensembles).
+ *
+ * Seuls les sous-ensembles accessibles depuis l'ensemble des états initiaux
+ * sont construits. L'état initial est l'état 0, et les autres états sont
+ * numérotés dans l'ordre d'un parcours en largeur qui suit les lettres par
+ * ordre croissant. L'automate créé n'est pas complété : il n'a pas d'état
+ * puits pour le sous-ensemble vide.
+ *
+ * \param automate L'automate de départ
+ * \return L'automate déterministe à créer
+ */
+Automate * creer_automate_deterministe( const Automate* automate );
+
+/**
+ * \brief Fait comme creer_automate_deterministe(), en explorant les
+ *        sous-ensembles avec plusieurs threads.
+ *
+ * L'automate créé est identique à celui renvoyé par
+ * creer_automate_deterministe(), quel que soit le nombre de threads.
+ * L'automate de départ ne doit pas être modifié pendant l'appel.
+ *
+ * \param automate L'automate de départ
+ * \param nb_threads Le nombre de threads, ou une valeur négative ou nulle
+ *        pour utiliser autant de threads que de processeurs disponibles
+ * \return L'automate déterministe à créer
+ */
+Automate * creer_automate_deterministe_parallele(
+	const Automate* automate, int nb_threads
+);
+
+/**
+ * \brief Reconnaisseur de mots construit à partir d'un automate, avec un
+ *        budget d'états pour sa déterminisation.
+ *
+ * Le reconnaisseur lit les mots sur l'automate déterministe tant que ses
+ * états sont construits, et simule l'automate non déterministe ailleurs.
+ */
+typedef struct _Reconnaisseur Reconnaisseur;
+
+/**
+ * \brief Statistiques d'un reconnaisseur.
+ */
+typedef struct {
+	/** Nombre d'états de l'automate déterministe (partiel) construit. */
+	size_t nb_etats;
+	/** Vrai si le budget d'états a été atteint. */
+	int budget_depasse;
+	/** Nombre de mots lus. */
+	size_t nb_mots;
+	/** Nombre de mots dont la lecture a dû simuler l'automate de départ. */
+	size_t nb_mots_simules;
+	/** Nombre de lettres lues en simulant l'automate de départ. */
+	size_t nb_lettres_simulees;
+	/** Nombre de fois où la simulation est retombée sur un état construit. */
+	size_t nb_retours_deterministe;
+} Statistiques_reconnaisseur;
+
+/**
+ * \brief Crée un reconnaisseur pour le langage de l'automate, en
+ *        déterminisant l'automate dans la limite d'un budget d'états.
+ *
+ * La déterminisation s'arrête de créer des états dès que l'automate
+ * déterministe en a 'nb_etats_max' : les transitions vers de nouveaux
+ * sous-ensembles ne sont alors pas construites, et le reconnaisseur simule
+ * l'automate de départ quand il doit les emprunter. La mémoire utilisée par
+ * le reconnaisseur est ainsi bornée, même pour les automates dont le
+ * déterminisé a un nombre exponentiel d'états.
+ *
+ * L'automate de départ est recopié (sans ses epsilon transitions) : il peut
+ * être modifié ou libéré ensuite.
+ *
+ * \param automate L'automate de départ
+ * \param nb_etats_max Le nombre maximal d'états de l'automate déterministe,
+ *        ou 0 pour ne pas limiter la déterminisation
+ * \return Le reconnaisseur à créer
+ */
+Reconnaisseur * creer_reconnaisseur( const Automate* automate, size_t nb_etats_max );
+
+/**
+ * \brief Libère le reconnaisseur.
+ *
+ * \param reconnaisseur Le reconnaisseur
+ */
+void liberer_reconnaisseur( Reconnaisseur * reconnaisseur );
+
+/**
+ * \brief Renvoie 1 si le mot est reconnu par l'automate du reconnaisseur,
+ *        0 sinon.
+ *
+ * Les statistiques du reconnaisseur sont mises à jour : deux lectures ne
+ * doivent pas se faire en même temps sur un même reconnaisseur.
+ *
+ * \param reconnaisseur Le reconnaisseur
+ * \param mot Le mot à lire
+ * \return 1 si le mot est reconnu, 0 sinon
+ */
+int reconnaitre_mot( Reconnaisseur * reconnaisseur, const char * mot );
+
+/**
+ * \brief Renvoie l'automate déterministe du reconnaisseur. Si le budget a
+ *        été dépassé, il lui manque des transitions.
+ *
+ * \param reconnaisseur Le reconnaisseur
+ * \return L'automate déterministe, qui appartient au reconnaisseur
+ */
+const Automate * get_automate_deterministe( const Reconnaisseur * reconnaisseur );
+
+/**
+ * \brief Renvoie les statistiques du reconnaisseur.
+ *
+ * \param reconnaisseur Le reconnaisseur
+ * \return Les statistiques
+ */
+Statistiques_reconnaisseur get_statistiques_reconnaisseur(
+	const Reconnaisseur * reconnaisseur
+);
+
+/**
+ * \brief Cache d'automate déterministe construit paresseusement, partagé
+ *        par les threads qui lisent des mots sur un même automate.
+ *
+ * Les états et les transitions de l'automate déterministe ne sont calculés
+ * (avec voisins()) que lorsqu'une lecture en a besoin, puis sont gardés pour
+ * les lectures suivantes de tous les threads. Suivre une transition déjà
+ * calculée ne prend aucun verrou.
+ */
+typedef struct _Cache_deterministe Cache_deterministe;
+
+/**
+ * \brief Statistiques d'un cache déterministe.
+ */
+typedef struct {
+	/** Nombre d'états actuellement dans le cache. */
+	size_t nb_etats;
+	/** Mémoire occupée par ces états, et par l'agrandissement des tables
+	 *  qui les rangent depuis le dernier vidage, en octets. */
+	size_t memoire;
+	/** Nombre de mots lus. */
+	size_t nb_mots;
+	/** Nombre de transitions calculées (absentes du cache). */
+	size_t nb_transitions_calculees;
+	/** Nombre de lettres lues en simulant l'automate, faute de mémoire. */
+	size_t nb_lettres_simulees;
+	/** Nombre de vidages du cache. */
+	size_t nb_vidages;
+} Statistiques_cache_deterministe;
+
+/**
+ * \brief Crée un cache déterministe vide (à l'état initial près) pour
+ *        l'automate.
+ *
+ * Quand la mémoire occupée par les états du cache (avec l'agrandissement des
+ * tables qui les rangent) atteint 'memoire_max', la lecture en cours 
+ * continue en simulant l'automate, puis le cache est vidé, une fois que les
+ * lectures en cours dans les autres threads sont terminées.
+ *
+ * L'automate de départ est recopié (sans ses epsilon transitions) : il peut
+ * être modifié ou libéré ensuite.
+ *
+ * \param automate L'automate de départ
+ * \param memoire_max La mémoire maximale occupée par les états du cache, en
+ *        octets, ou 0 pour ne pas la limiter
+ * \return Le cache à créer
+ */
+Cache_deterministe * creer_cache_deterministe(
+	const Automate* automate, size_t memoire_max
+);
+
+/**
+ * \brief Libère le cache. Aucun thread ne doit plus l'utiliser.
+ *
+ * \param cache Le cache
+ */
+void liberer_cache_deterministe( Cache_deterministe * cache );
+
+/**
+ * \brief Renvoie 1 si le mot est reconnu par l'automate du cache, 0 sinon.
+ *
+ * Plusieurs threads peuvent lire des mots en même temps sur un même cache.
+ * Une lecture ne prend aucun verrou, sauf pendant un vidage du cache.
+ *
+ * \param cache Le cache
+ * \param mot Le mot à lire
+ * \return 1 si le mot est reconnu, 0 sinon
+ */
+int reconnaitre_mot_avec_cache( Cache_deterministe * cache, const char * mot );
+
+/**
+ * \brief Renvoie les statistiques du cache.
+ *
+ * \param cache Le cache
+ * \return Les statistiques
+ */
+Statistiques_cache_deterministe get_statistiques_cache_deterministe(
+	const Cache_deterministe * cache
+);
+
 
 /**
   * \brief Créer l'automate du mélange.
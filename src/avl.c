@@ -814,6 +814,93 @@ avl_copy (const struct avl_table *org, avl_copy_func *copy,
     }
 }
 
+/* Frees the nodes of the subtree rooted at |node|, without touching their
+   data. */
+static void
+destroy_nodes (struct avl_table *tree, struct avl_node *node)
+{
+  while (node != NULL)
+    {
+      struct avl_node *right = node->avl_link[1];
+      destroy_nodes (tree, node->avl_link[0]);
+      tree->avl_alloc->libavl_free (tree->avl_alloc, node);
+      node = right;
+    }
+}
+
+/* Builds a perfectly balanced subtree from the |count| items of |items|
+   and stores its height into |*height|.
+   Returns the root of the subtree, or |NULL| if |count| is zero or if a
+   memory allocation error occurred, in which case |*height| is negative. */
+static struct avl_node *
+build_balanced (struct avl_table *tree, void **items, size_t count,
+                int *height)
+{
+  struct avl_node *node;
+  size_t middle = count / 2;
+  int left_height, right_height;
+
+  if (count == 0)
+    {
+      *height = 0;
+      return NULL;
+    }
+
+  node = tree->avl_alloc->libavl_malloc (tree->avl_alloc, sizeof *node);
+  if (node == NULL)
+    {
+      *height = -1;
+      return NULL;
+    }
+
+  node->avl_data = items[middle];
+  node->avl_link[0] = build_balanced (tree, items, middle, &left_height);
+  if (left_height < 0)
+    {
+      node->avl_link[1] = NULL;
+      destroy_nodes (tree, node);
+      *height = -1;
+      return NULL;
+    }
+  node->avl_link[1] = build_balanced (tree, items + middle + 1,
+                                      count - middle - 1, &right_height);
+  if (right_height < 0)
+    {
+      destroy_nodes (tree, node);
+      *height = -1;
+      return NULL;
+    }
+
+  /* The left subtree never holds fewer items than the right one,
+     so the balance factor is either 0 or -1. */
+  node->avl_balance = right_height - left_height;
+  *height = (left_height > right_height ? left_height : right_height) + 1;
+  return node;
+}
+
+/* Fills |tree|, which must be empty, with the |count| items of |items|.
+   The items must be sorted in increasing order according to |tree|'s
+   comparison function and must not contain duplicates.
+   The resulting tree is perfectly balanced and is built in linear time.
+   Returns nonzero on success, zero if a memory allocation error occurred,
+   in which case |tree| is left empty. */
+int
+avl_build (struct avl_table *tree, void **items, size_t count)
+{
+  int height;
+
+  assert (tree != NULL && tree->avl_root == NULL);
+  assert (count == 0 || items != NULL);
+
+  tree->avl_root = build_balanced (tree, items, count, &height);
+  if (height < 0)
+    return 0;
+
+  tree->avl_count = count;
+  tree->avl_generation++;
+  return 1;
+}
+
 /* Frees storage allocated for |tree|.
    If |destroy != NULL|, applies it to each data item in inorder. */
 void
@@ -47,9 +47,14 @@ extern struct libavl_allocator avl_allocator_default;
 void *avl_malloc (struct libavl_allocator *, size_t);
 void avl_free (struct libavl_allocator *, void *);
 
-/* Maximum AVL height. */
+/* Maximum AVL height.
+   An AVL tree of height h has at least F(h + 2) - 1 nodes, F being the
+   Fibonacci sequence with F(1) = F(2) = 1.  A height of 32 is thus
+   reachable with F(34) - 1 = 5702886 nodes, and a height of 49 needs
+   F(51) - 1 (about 2.0e10) nodes: 48 covers every tree of fewer than
+   2.0e10 nodes.  bench_table has been run up to 1e7 keys. */
 #ifndef AVL_MAX_HEIGHT
-#define AVL_MAX_HEIGHT 32
+#define AVL_MAX_HEIGHT 48
 #endif
 
 /* Tree data structure. */
@@ -95,6 +100,7 @@ void *avl_delete (struct avl_table *, const void *);
 void *avl_find (const struct avl_table *, const void *);
 void avl_assert_insert (struct avl_table *, void *);
 void *avl_assert_delete (struct avl_table *, void *);
+int avl_build (struct avl_table *, void **, size_t);
 
 #define avl_count(table) ((size_t) (table)->avl_count)
 
@@ -0,0 +1,138 @@
+/*
+ *   Ce fichier fait parti d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux 1
+ *
+ *   Copyright (C) 2014 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+/*
+ * Mesure le temps des fonctions qui émondent un automate : 
+ * automate_accessible(), automate_co_accessible() et automate_emonde().
+ *
+ * Les automates mesurés sont des produits complets (sur tous les couples 
+ * d'états, et pas seulement sur les couples accessibles) de deux automates 
+ * déterministes aléatoires à k états sur l'alphabet {a, b} : comme ceux 
+ * que construit un produit naïf, ils contiennent beaucoup d'états 
+ * inaccessibles ou non co-accessibles. Leur unique état final est 
+ * accessible.
+ *
+ * Pour des produits de n = k*k états, avec n allant de 10^3 jusqu'à la 
+ * taille maximale passée en argument (10^5 par défaut), le programme affiche
+ * le temps de construction du produit, le temps de chaque fonction (en 
+ * nanosecondes par état) et le nombre d'états de l'automate émondé.
+ *
+ * Utilisation : ./bench_automate [taille_maximale]
+ */
+
+#include "automate.h"
+#include "ensemble.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+double nanosecondes_depuis( clock_t debut, long n ){
+	return 1e9 * (double) ( clock() - debut ) / CLOCKS_PER_SEC / n;
+}
+
+/*
+ * Renvoie le produit de deux automates déterministes aléatoires à k états.
+ * L'état (i, j) du produit est numéroté i*k + j.
+ */
+Automate * creer_produit_aleatoire( int k ){
+	int* transitions = xmalloc( 4 * k * sizeof(int) );
+	int i, j, l;
+	for( i=0; i<4*k; i++ ){
+		transitions[i] = rand() % k;
+	}
+	// transitions[ 2*q + l ] pour le premier automate, 
+	// transitions[ 2*k + 2*q + l ] pour le second.
+	Automate * produit = creer_automate();
+	for( i=0; i<k; i++ ){
+		for( j=0; j<k; j++ ){
+			for( l=0; l<2; l++ ){
+				ajouter_transition( 
+					produit, i*k + j, 'a' + l, 
+					transitions[ 2*i + l ] * k + transitions[ 2*k + 2*j + l ]
+				);
+			}
+		}
+	}
+	// L'état final est atteint depuis l'état initial par un mot aléatoire :
+	// l'automate émondé n'est donc pas vide.
+	ajouter_etat_initial( produit, 0 );
+	i = 0;
+	j = 0;
+	for( l=0; l<k; l++ ){
+		int lettre = rand() % 2;
+		i = transitions[ 2*i + lettre ];
+		j = transitions[ 2*k + 2*j + lettre ];
+	}
+	ajouter_etat_final( produit, i*k + j );
+	xfree( transitions );
+	return produit;
+}
+
+int main( int argc, char* argv[] ){
+	long maximum = 100000;
+	if( argc > 1 ){
+		maximum = atol( argv[1] );
+	}
+
+	printf(
+		"%10s %12s %12s %14s %10s %10s\n", "n", "construction", 
+		"accessible", "co_accessible", "emonde", "etats"
+	);
+	long n;
+	for( n = 1000; n <= maximum; n *= 10 ){
+		int k = 1;
+		while( (long) ( k + 1 ) * ( k + 1 ) <= n ){
+			k++;
+		}
+		srand( 1 );
+
+		clock_t debut = clock();
+		Automate * produit = creer_produit_aleatoire( k );
+		double construction = nanosecondes_depuis( debut, n );
+
+		debut = clock();
+		Automate * accessible = automate_accessible( produit );
+		double temps_accessible = nanosecondes_depuis( debut, n );
+
+		debut = clock();
+		Automate * co_accessible = automate_co_accessible( produit );
+		double temps_co_accessible = nanosecondes_depuis( debut, n );
+
+		debut = clock();
+		Automate * emonde = automate_emonde( produit );
+		double temps_emonde = nanosecondes_depuis( debut, n );
+
+		printf(
+			"%10ld %12.1f %12.1f %14.1f %10.1f %10u\n", n, construction, 
+			temps_accessible, temps_co_accessible, temps_emonde,
+			taille_ensemble( get_etats( emonde ) )
+		);
+
+		liberer_automate( emonde );
+		liberer_automate( co_accessible );
+		liberer_automate( accessible );
+		liberer_automate( produit );
+	}
+	return 0;
+}
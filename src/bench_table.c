@@ -0,0 +1,177 @@
+/*
+ *   Ce fichier fait parti d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux 1
+ *
+ *   Copyright (C) 2014 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+/*
+ * Compare les différents codages des tables : AVL, AVL cousu, arbre B+ et
+ * table de hachage.
+ *
+ * Pour chaque codage et pour des tailles n allant de 10^4 jusqu'à la taille
+ * maximale passée en argument (10^6 par défaut), le programme mesure le
+ * temps d'insertion de n clés dans un ordre aléatoire, de n recherches
+ * réussies, d'un parcours complet et de la suppression de toutes les clés.
+ * Les temps sont donnés en nanosecondes par clé : une colonne qui reste 
+ * stable quand n grandit correspond à une opération en temps constant.
+ * La dernière colonne est la mémoire occupée par la table remplie (voir 
+ * memoire_table()), en mégaoctets.
+ *
+ * Pour les grandes tailles, on peut ne mesurer qu'un codage. Le programme a
+ * été exécuté jusqu'à 10^7 clés, où l'AVL occupe environ 1 Go : 10^8 clés 
+ * demandent une dizaine de Go.
+ *
+ * Utilisation : ./bench_table [taille_maximale [avl|cousue|arbre_b|hachage]]
+ */
+
+#include "table.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct {
+	const char* nom;
+	Table* (*creer)( void );
+} Codage;
+
+Table* creer_bench_avl(){
+	return creer_table( NULL, NULL, NULL );
+}
+
+Table* creer_bench_cousue(){
+	return creer_table_cousue( NULL, NULL, NULL );
+}
+
+Table* creer_bench_arbre_b(){
+	return creer_table_arbre_b( NULL, NULL, NULL );
+}
+
+Table* creer_bench_hachage(){
+	return creer_table_hachage( NULL, NULL, NULL, NULL );
+}
+
+/*
+ * Renvoie le temps écoulé depuis 'debut', en nanosecondes par clé.
+ */
+double nanosecondes_depuis( clock_t debut, long n ){
+	return 1e9 * (double) ( clock() - debut ) / CLOCKS_PER_SEC / n;
+}
+
+/*
+ * Remplit 'cles' avec une permutation aléatoire de 1, ..., n.
+ */
+void melanger_cles( intptr_t* cles, long n ){
+	long i;
+	for( i=0; i<n; i++ ){
+		cles[i] = i+1;
+	}
+	for( i=n-1; i>0; i-- ){
+		long j = ( (long) rand() * RAND_MAX + rand() ) % ( i+1 );
+		intptr_t tmp = cles[i];
+		cles[i] = cles[j];
+		cles[j] = tmp;
+	}
+}
+
+void mesurer( const Codage* codage, const intptr_t* cles, long n ){
+	long i;
+	clock_t debut;
+	intptr_t somme = 0;
+
+	debut = clock();
+	Table* table = codage->creer();
+	for( i=0; i<n; i++ ){
+		add_table( table, cles[i], i );
+	}
+	double insertion = nanosecondes_depuis( debut, n );
+
+	debut = clock();
+	for( i=n-1; i>=0; i-- ){
+		somme += *chercher_valeur_table( table, cles[i] );
+	}
+	double recherche = nanosecondes_depuis( debut, n );
+
+	debut = clock();
+	Table_curseur curseur;
+	for(
+		placer_curseur_table( &curseur, table );
+		! curseur_table_est_vide( &curseur );
+		avancer_curseur_table( &curseur )
+	){
+		somme -= valeur_du_curseur_table( &curseur );
+	}
+	double parcours = nanosecondes_depuis( debut, n );
+
+	double memoire = memoire_table( table ) / ( 1024.0 * 1024.0 );
+
+	debut = clock();
+	for( i=0; i<n; i++ ){
+		delete_table( table, cles[i] );
+	}
+	liberer_table( table );
+	double suppression = nanosecondes_depuis( debut, n );
+
+	if( somme != 0 ){
+		ERREUR( "Résultat incohérent" );
+	}
+	printf(
+		"%-10s %10ld %10.1f %10.1f %10.1f %12.1f %12.1f\n", codage->nom, n, 
+		insertion, recherche, parcours, suppression, memoire
+	);
+}
+
+int main( int argc, char* argv[] ){
+	long maximum = 1000000;
+	const char* seul = NULL;
+	if( argc > 1 ){
+		maximum = atol( argv[1] );
+	}
+	if( argc > 2 ){
+		seul = argv[2];
+	}
+	Codage codages[] = {
+		{ "avl", creer_bench_avl },
+		{ "cousue", creer_bench_cousue },
+		{ "arbre_b", creer_bench_arbre_b },
+		{ "hachage", creer_bench_hachage }
+	};
+	const int nb_codages = sizeof( codages ) / sizeof( Codage );
+
+	printf(
+		"%-10s %10s %10s %10s %10s %12s %12s\n", "codage", "n", 
+		"insertion", "recherche", "parcours", "suppression", "memoire(Mo)"
+	);
+	long n;
+	for( n = 10000; n <= maximum; n *= 10 ){
+		intptr_t* cles = xmalloc( n * sizeof(intptr_t) );
+		srand( 1 );
+		melanger_cles( cles, n );
+		int c;
+		for( c=0; c<nb_codages; c++ ){
+			if( ! seul || strcmp( seul, codages[c].nom ) == 0 ){
+				mesurer( &codages[c], cles, n );
+			}
+		}
+		xfree( cles );
+	}
+	return 0;
+}
@@ -0,0 +1,326 @@
+/*
+ *   Ce fichier fait parti d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux 1
+ *
+ *   Copyright (C) 2014 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+
+#ifndef __CONTENEURS_TYPES_H__
+#define __CONTENEURS_TYPES_H__
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "outils.h"
+
+/*
+ * Générateurs de conteneurs typés.
+ *
+ * Les tables et les ensembles de table.h et ensemble.h contiennent des 
+ * intptr_t et comparent leurs éléments à l'aide de pointeurs de fonctions : le 
+ * compilateur ne peut donc ni mettre en ligne les comparaisons, ni ranger 
+ * directement des structures.
+ *
+ * Les macros suivantes définissent au contraire, pour un type donné, un 
+ * conteneur et ses fonctions (static inline), dans lesquelles la comparaison
+ * est écrite en toutes lettres. Les éléments sont rangés triés dans un 
+ * tableau : la recherche est dichotomique, le parcours se fait directement 
+ * sur le tableau, et l'ajout d'un élément plus grand que tous les autres se 
+ * fait en temps constant (amorti). L'ajout ailleurs décale la fin du 
+ * tableau : ces conteneurs sont faits pour de petits ensembles ou pour des 
+ * éléments ajoutés à peu près dans l'ordre.
+ *
+ * 'comparer' est le nom d'une fonction ou d'une macro qui prend deux 
+ * éléments du type et renvoie un entier négatif, nul ou positif, comme 
+ * COMPARER_VALEURS() pour les types de base.
+ *
+ * Exemple :
+ *
+ * DEFINIR_ENSEMBLE( Ensemble_entiers, int, COMPARER_VALEURS )
+ *
+ * Ensemble_entiers ens;
+ * Ensemble_entiers_initialiser( &ens );
+ * Ensemble_entiers_ajouter( &ens, 3 );
+ * size_t i;
+ * for( i=0; i<ens.nb; i++ ){
+ *     printf( "%d\n", ens.elements[i] );
+ * }
+ * Ensemble_entiers_liberer( &ens );
+ */
+
+#define COMPARER_VALEURS( a, b ) ( ( (a) > (b) ) - ( (a) < (b) ) )
+
+/*
+ * Agrandit un tableau géré par un conteneur typé pour qu'il puisse contenir 
+ * au moins 'nb' éléments de taille 'taille'.
+ */
+static inline void* agrandir_conteneur(
+	void* tableau, size_t* capacite, size_t nb, size_t taille
+){
+	if( nb <= *capacite ) return tableau;
+	size_t nouvelle = ( *capacite < 4 ) ? 4 : 2 * (*capacite);
+	if( nouvelle < nb ) nouvelle = nb;
+	tableau = realloc( tableau, nouvelle * taille );
+	if( ! tableau ){
+		ERREUR( "Espace insuffisant" );
+	}
+	*capacite = nouvelle;
+	return tableau;
+}
+
+/*
+ * Définit le type 'nom', ensemble ordonné d'éléments de type 'type', et les
+ * fonctions :
+ *  - void nom_initialiser( nom* ens ) : initialise un ensemble vide ;
+ *  - void nom_liberer( nom* ens ) : libère la mémoire de l'ensemble, qui 
+ *    redevient vide ;
+ *  - void nom_vider( nom* ens ) : retire tous les éléments, sans libérer 
+ *    la mémoire ;
+ *  - size_t nom_position( const nom* ens, type element ) : renvoie l'indice
+ *    du premier élément supérieur ou égal à 'element' ;
+ *  - int nom_contient( const nom* ens, type element ) ;
+ *  - int nom_ajouter( nom* ens, type element ) : renvoie 1 si l'élément a été
+ *    ajouté, 0 s'il était déjà présent ;
+ *  - int nom_retirer( nom* ens, type element ) : renvoie 1 si l'élément a été
+ *    retiré, 0 s'il était absent ;
+ *  - void nom_empiler( nom* ens, type element ) : ajoute l'élément à la fin 
+ *    du tableau, en temps constant (amorti), sans trier ni chercher de 
+ *    doublon ;
+ *  - void nom_normaliser( nom* ens ) : trie les éléments et retire les 
+ *    doublons, en O(n log n).
+ * Les éléments sont ens->elements[0], ..., ens->elements[ens->nb - 1], par 
+ * ordre croissant.
+ *
+ * Après nom_empiler(), et jusqu'à l'appel de nom_normaliser(), l'ensemble 
+ * n'est plus trié : seuls nom_empiler(), nom_normaliser(), nom_vider() et 
+ * nom_liberer() peuvent alors être utilisés. Empiler puis normaliser une 
+ * seule fois est la manière rapide de remplir un grand ensemble dans le 
+ * désordre.
+ */
+#define DEFINIR_ENSEMBLE( nom, type, comparer ) \
+typedef struct { \
+	type * elements; \
+	size_t nb; \
+	size_t capacite; \
+} nom; \
+\
+static inline void nom##_initialiser( nom * ens ){ \
+	ens->elements = NULL; \
+	ens->nb = 0; \
+	ens->capacite = 0; \
+} \
+\
+static inline void nom##_liberer( nom * ens ){ \
+	xfree( ens->elements ); \
+	nom##_initialiser( ens ); \
+} \
+\
+static inline void nom##_vider( nom * ens ){ \
+	ens->nb = 0; \
+} \
+\
+static inline size_t nom##_position( const nom * ens, type element ){ \
+	size_t debut = 0; \
+	size_t fin = ens->nb; \
+	while( debut < fin ){ \
+		size_t milieu = ( debut + fin ) / 2; \
+		if( comparer( ens->elements[milieu], element ) < 0 ){ \
+			debut = milieu + 1; \
+		}else{ \
+			fin = milieu; \
+		} \
+	} \
+	return debut; \
+} \
+\
+static inline int nom##_contient( const nom * ens, type element ){ \
+	size_t i = nom##_position( ens, element ); \
+	return i < ens->nb && comparer( ens->elements[i], element ) == 0; \
+} \
+\
+static inline int nom##_ajouter( nom * ens, type element ){ \
+	size_t i = ens->nb; \
+	if( i > 0 && comparer( ens->elements[i-1], element ) >= 0 ){ \
+		i = nom##_position( ens, element ); \
+		if( comparer( ens->elements[i], element ) == 0 ) return 0; \
+	} \
+	ens->elements = agrandir_conteneur( \
+		ens->elements, &ens->capacite, ens->nb + 1, sizeof(type) \
+	); \
+	memmove( \
+		ens->elements + i + 1, ens->elements + i, \
+		( ens->nb - i ) * sizeof(type) \
+	); \
+	ens->elements[i] = element; \
+	ens->nb++; \
+	return 1; \
+} \
+\
+static inline int nom##_retirer( nom * ens, type element ){ \
+	size_t i = nom##_position( ens, element ); \
+	if( i == ens->nb || comparer( ens->elements[i], element ) != 0 ){ \
+		return 0; \
+	} \
+	memmove( \
+		ens->elements + i, ens->elements + i + 1, \
+		( ens->nb - i - 1 ) * sizeof(type) \
+	); \
+	ens->nb--; \
+	return 1; \
+} \
+\
+static inline void nom##_empiler( nom * ens, type element ){ \
+	ens->elements = agrandir_conteneur( \
+		ens->elements, &ens->capacite, ens->nb + 1, sizeof(type) \
+	); \
+	ens->elements[ ens->nb++ ] = element; \
+} \
+\
+static inline int nom##_comparer_elements( const void * a, const void * b ){ \
+	return comparer( *(const type *) a, *(const type *) b ); \
+} \
+\
+static inline void nom##_normaliser( nom * ens ){ \
+	if( ens->nb < 2 ) return; \
+	qsort( ens->elements, ens->nb, sizeof(type), nom##_comparer_elements ); \
+	size_t i, nb = 1; \
+	for( i=1; i<ens->nb; i++ ){ \
+		if( comparer( ens->elements[nb-1], ens->elements[i] ) != 0 ){ \
+			ens->elements[nb++] = ens->elements[i]; \
+		} \
+	} \
+	ens->nb = nb; \
+}
+
+/*
+ * Définit le type 'nom', table ordonnée associant des valeurs de type 
+ * 'type_valeur' à des clés de type 'type_cle', et les fonctions :
+ *  - void nom_initialiser( nom* table ), void nom_liberer( nom* table ) et
+ *    void nom_vider( nom* table ), comme pour DEFINIR_ENSEMBLE() ;
+ *  - size_t nom_position( const nom* table, type_cle cle ) : renvoie 
+ *    l'indice de la première clé supérieure ou égale à 'cle' ;
+ *  - type_valeur* nom_trouver( const nom* table, type_cle cle ) : renvoie 
+ *    l'adresse de la valeur associée à la clé, ou NULL ;
+ *  - type_valeur* nom_trouver_ou_ajouter( nom* table, type_cle cle, 
+ *    int* nouvelle ) : comme trouver_ou_ajouter_table() ; la valeur d'une 
+ *    clé ajoutée n'est pas initialisée ;
+ *  - int nom_retirer( nom* table, type_cle cle ) : renvoie 1 si la clé a été
+ *    retirée, 0 si elle était absente.
+ * Les clés sont table->cles[0], ..., table->cles[table->nb - 1], par ordre 
+ * croissant, et table->valeurs[i] est la valeur associée à table->cles[i].
+ * Une adresse de valeur n'est plus valide dès que la table est modifiée.
+ */
+#define DEFINIR_TABLE( nom, type_cle, type_valeur, comparer ) \
+typedef struct { \
+	type_cle * cles; \
+	type_valeur * valeurs; \
+	size_t nb; \
+	size_t capacite; \
+} nom; \
+\
+static inline void nom##_initialiser( nom * table ){ \
+	table->cles = NULL; \
+	table->valeurs = NULL; \
+	table->nb = 0; \
+	table->capacite = 0; \
+} \
+\
+static inline void nom##_liberer( nom * table ){ \
+	xfree( table->cles ); \
+	xfree( table->valeurs ); \
+	nom##_initialiser( table ); \
+} \
+\
+static inline void nom##_vider( nom * table ){ \
+	table->nb = 0; \
+} \
+\
+static inline size_t nom##_position( const nom * table, type_cle cle ){ \
+	size_t debut = 0; \
+	size_t fin = table->nb; \
+	while( debut < fin ){ \
+		size_t milieu = ( debut + fin ) / 2; \
+		if( comparer( table->cles[milieu], cle ) < 0 ){ \
+			debut = milieu + 1; \
+		}else{ \
+			fin = milieu; \
+		} \
+	} \
+	return debut; \
+} \
+\
+static inline type_valeur * nom##_trouver( const nom * table, type_cle cle ){ \
+	size_t i = nom##_position( table, cle ); \
+	if( i < table->nb && comparer( table->cles[i], cle ) == 0 ){ \
+		return &table->valeurs[i]; \
+	} \
+	return NULL; \
+} \
+\
+static inline type_valeur * nom##_trouver_ou_ajouter( \
+	nom * table, type_cle cle, int * nouvelle \
+){ \
+	size_t i = table->nb; \
+	if( i > 0 && comparer( table->cles[i-1], cle ) >= 0 ){ \
+		i = nom##_position( table, cle ); \
+		if( comparer( table->cles[i], cle ) == 0 ){ \
+			if( nouvelle ) *nouvelle = 0; \
+			return &table->valeurs[i]; \
+		} \
+	} \
+	size_t capacite = table->capacite; \
+	table->cles = agrandir_conteneur( \
+		table->cles, &capacite, table->nb + 1, sizeof(type_cle) \
+	); \
+	table->valeurs = agrandir_conteneur( \
+		table->valeurs, &table->capacite, table->nb + 1, sizeof(type_valeur) \
+	); \
+	memmove( \
+		table->cles + i + 1, table->cles + i, \
+		( table->nb - i ) * sizeof(type_cle) \
+	); \
+	memmove( \
+		table->valeurs + i + 1, table->valeurs + i, \
+		( table->nb - i ) * sizeof(type_valeur) \
+	); \
+	table->cles[i] = cle; \
+	table->nb++; \
+	if( nouvelle ) *nouvelle = 1; \
+	return &table->valeurs[i]; \
+} \
+\
+static inline int nom##_retirer( nom * table, type_cle cle ){ \
+	size_t i = nom##_position( table, cle ); \
+	if( i == table->nb || comparer( table->cles[i], cle ) != 0 ){ \
+		return 0; \
+	} \
+	memmove( \
+		table->cles + i, table->cles + i + 1, \
+		( table->nb - i - 1 ) * sizeof(type_cle) \
+	); \
+	memmove( \
+		table->valeurs + i, table->valeurs + i + 1, \
+		( table->nb - i - 1 ) * sizeof(type_valeur) \
+	); \
+	table->nb--; \
+	return 1; \
+}
+
+#endif
@@ -0,0 +1,1421 @@
+/*
+ *   Ce fichier fait parti d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux 1
+ *
+ *   Copyright (C) 2014 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+/**
+ * \file determinisation.c
+ * \brief Déterminisation d'un automate par la construction des sous-ensembles.
+ *
+ * Chaque état de l'automate déterministe est un sous-ensemble d'états de 
+ * l'automate de départ. Les sous-ensembles sont explorés par des ouvriers 
+ * (des threads, ou seulement le thread appelant pour la version 
+ * séquentielle) : chaque ouvrier a sa propre file de sous-ensembles à 
+ * explorer, et vient prendre du travail dans les files des autres quand la 
+ * sienne est vide. Pour chaque lettre, l'ouvrier calcule le sous-ensemble 
+ * successeur et le cherche dans un ensemble partagé, découpé
+ * en parties protégées chacune par un verrou : un sous-ensemble n'y est 
+ * rangé (et numéroté) qu'une seule fois.
+ *
+ * L'ordre dans lequel les sous-ensembles sont découverts dépend des 
+ * threads : les états sont donc renumérotés à la fin, dans l'ordre d'un 
+ * parcours en largeur depuis l'état initial qui suit les lettres par ordre 
+ * croissant. Le résultat ne dépend ainsi pas du nombre de threads.
+ *
+ * La déterminisation peut être limitée à un nombre de sous-ensembles : le
+ * reconnaisseur (voir creer_reconnaisseur()) lit alors les mots sur 
+ * l'automate déterministe partiel obtenu, et simule l'automate de départ là
+ * où des transitions manquent.
+ */
+
+#include "automate.h"
+#include "table.h"
+#include "fifo.h"
+#include "outils.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * Nombre de parties de l'ensemble partagé des sous-ensembles : deux 
+ * ouvriers ne se bloquent que s'ils cherchent des sous-ensembles de la même
+ * partie.
+ */
+#define NB_PARTIES_SOUS_ENSEMBLES 64
+
+/*
+ * Numéro d'état qui ne désigne aucun état.
+ */
+#define SANS_ETAT ( (size_t) -1 )
+
+/*
+ * Un sous-ensemble d'états de l'automate de départ, trié par ordre 
+ * strictement croissant, et son numéro dans l'automate déterministe 
+ * (avant la renumérotation finale).
+ * 'incomplet' est vrai si un de ses successeurs n'a pas été construit, 
+ * faute de budget.
+ */
+typedef struct {
+	unsigned long hachage;
+	size_t numero;
+	int final;
+	int incomplet;
+	size_t nb;
+	int etats[];
+} Sous_ensemble;
+
+typedef struct {
+	size_t origine;
+	char lettre;
+	size_t fin;
+} Transition_deterministe;
+
+/*
+ * Une transition de l'automate de départ, sans son origine.
+ */
+typedef struct {
+	char lettre;
+	int fin;
+} Arrivee;
+
+typedef struct {
+	pthread_mutex_t verrou;
+	Table * sous_ensembles;
+} Partie_sous_ensembles;
+
+typedef struct _Determinisation Determinisation;
+
+typedef struct {
+	Determinisation * determinisation;
+	pthread_mutex_t verrou;
+	Fifo * a_explorer;
+	Transition_deterministe * transitions;
+	size_t nb_transitions;
+	size_t capacite_transitions;
+	Arrivee * arrivees;
+	size_t nb_arrivees;
+	size_t capacite_arrivees;
+	Sous_ensemble * successeur;
+	size_t capacite_successeur;
+} Ouvrier;
+
+struct _Determinisation {
+	const Automate * automate;
+	Partie_sous_ensembles parties[ NB_PARTIES_SOUS_ENSEMBLES ];
+	atomic_size_t nb_sous_ensembles;
+	size_t nb_sous_ensembles_max;
+	atomic_int budget_depasse;
+	atomic_long nb_a_explorer;
+	Ouvrier * ouvriers;
+	int nb_ouvriers;
+	// Un ouvrier qui ne trouve aucun travail attend sur 'travail_disponible',
+	// signalée quand un sous-ensemble est confié ou quand tout est exploré.
+	pthread_mutex_t verrou_attente;
+	pthread_cond_t travail_disponible;
+	atomic_int nb_en_attente;
+};
+
+unsigned long hacher_sous_ensemble( const intptr_t sous_ensemble ){
+	return ( (const Sous_ensemble *) sous_ensemble )->hachage;
+}
+
+int comparer_sous_ensembles( const intptr_t a, const intptr_t b ){
+	const Sous_ensemble * s1 = (const Sous_ensemble *) a;
+	const Sous_ensemble * s2 = (const Sous_ensemble *) b;
+	if( s1->nb != s2->nb ){
+		return s1->nb < s2->nb ? -1 : 1;
+	}
+	return memcmp( s1->etats, s2->etats, s1->nb * sizeof( int ) );
+}
+
+/*
+ * Calcule la valeur de hachage du sous-ensemble à partir de ses états.
+ */
+void calculer_hachage_sous_ensemble( Sous_ensemble * sous_ensemble ){
+	unsigned long h = 14695981039346656037UL;
+	size_t i;
+	for( i=0; i<sous_ensemble->nb; i++ ){
+		h = ( h ^ (unsigned int) sous_ensemble->etats[i] ) * 1099511628211UL;
+	}
+	sous_ensemble->hachage = h;
+}
+
+Sous_ensemble * allouer_sous_ensemble( size_t capacite ){
+	Sous_ensemble * res = xmalloc( sizeof( Sous_ensemble ) + capacite * sizeof( int ) );
+	res->nb = 0;
+	return res;
+}
+
+/*
+ * Ajoute un sous-ensemble à explorer dans la file de l'ouvrier.
+ */
+void confier_sous_ensemble( Ouvrier * ouvrier, Sous_ensemble * sous_ensemble ){
+	// Le compteur est augmenté avant l'ajout : il ne peut pas tomber à 0 
+	// tant qu'un sous-ensemble reste à explorer.
+	Determinisation * d = ouvrier->determinisation;
+	atomic_fetch_add( &d->nb_a_explorer, 1 );
+	pthread_mutex_lock( &ouvrier->verrou );
+	ajouter_fifo( ouvrier->a_explorer, (intptr_t) sous_ensemble );
+	pthread_mutex_unlock( &ouvrier->verrou );
+	if( atomic_load( &d->nb_en_attente ) ){
+		pthread_mutex_lock( &d->verrou_attente );
+		pthread_cond_signal( &d->travail_disponible );
+		pthread_mutex_unlock( &d->verrou_attente );
+	}
+}
+
+/*
+ * Retire un sous-ensemble de la file de l'ouvrier, ou renvoie NULL si elle 
+ * est vide.
+ */
+Sous_ensemble * retirer_sous_ensemble( Ouvrier * ouvrier ){
+	Sous_ensemble * res = NULL;
+	pthread_mutex_lock( &ouvrier->verrou );
+	if( ! est_vide( ouvrier->a_explorer ) ){
+		res = (Sous_ensemble *) retirer_fifo( ouvrier->a_explorer );
+	}
+	pthread_mutex_unlock( &ouvrier->verrou );
+	return res;
+}
+
+/*
+ * Renvoie le sous-ensemble rangé égal à celui passé en paramètre. S'il n'y 
+ * en a pas, une copie est rangée, numérotée et confiée à l'ouvrier ; si le 
+ * budget de sous-ensembles est épuisé, rien n'est rangé et la fonction 
+ * renvoie NULL.
+ */
+Sous_ensemble * interner_sous_ensemble( 
+	Ouvrier * ouvrier, const Sous_ensemble * sous_ensemble 
+){
+	Determinisation * d = ouvrier->determinisation;
+	Partie_sous_ensembles * partie = 
+		&d->parties[ ( sous_ensemble->hachage >> 7 ) % NB_PARTIES_SOUS_ENSEMBLES ];
+
+	pthread_mutex_lock( &partie->verrou );
+	const intptr_t * connu = chercher_valeur_table( 
+		partie->sous_ensembles, (intptr_t) sous_ensemble 
+	);
+	if( connu ){
+		Sous_ensemble * res = (Sous_ensemble *) *connu;
+		pthread_mutex_unlock( &partie->verrou );
+		return res;
+	}
+	size_t numero = atomic_load( &d->nb_sous_ensembles );
+	do{
+		if( numero >= d->nb_sous_ensembles_max ){
+			atomic_store( &d->budget_depasse, 1 );
+			pthread_mutex_unlock( &partie->verrou );
+			return NULL;
+		}
+	}while( 
+		! atomic_compare_exchange_weak( &d->nb_sous_ensembles, &numero, numero + 1 ) 
+	);
+	Sous_ensemble * copie = allouer_sous_ensemble( sous_ensemble->nb );
+	memcpy( 
+		copie, sous_ensemble, 
+		sizeof( Sous_ensemble ) + sous_ensemble->nb * sizeof( int ) 
+	);
+	copie->numero = numero;
+	copie->incomplet = 0;
+	copie->final = 0;
+	size_t i;
+	for( i=0; i<copie->nb && ! copie->final; i++ ){
+		copie->final = est_un_etat_final_de_l_automate( d->automate, copie->etats[i] );
+	}
+	add_table( partie->sous_ensembles, (intptr_t) copie, (intptr_t) copie );
+	pthread_mutex_unlock( &partie->verrou );
+
+	confier_sous_ensemble( ouvrier, copie );
+	return copie;
+}
+
+void noter_transition_deterministe( 
+	Ouvrier * ouvrier, size_t origine, char lettre, size_t fin 
+){
+	if( ouvrier->nb_transitions == ouvrier->capacite_transitions ){
+		size_t capacite = 2 * ouvrier->capacite_transitions + 16;
+		Transition_deterministe * transitions = 
+			xmalloc( capacite * sizeof( Transition_deterministe ) );
+		memcpy( 
+			transitions, ouvrier->transitions, 
+			ouvrier->nb_transitions * sizeof( Transition_deterministe ) 
+		);
+		xfree( ouvrier->transitions );
+		ouvrier->transitions = transitions;
+		ouvrier->capacite_transitions = capacite;
+	}
+	Transition_deterministe * t = &ouvrier->transitions[ ouvrier->nb_transitions++ ];
+	t->origine = origine;
+	t->lettre = lettre;
+	t->fin = fin;
+}
+
+int comparer_arrivees( const void * a, const void * b ){
+	const Arrivee * a1 = (const Arrivee *) a;
+	const Arrivee * a2 = (const Arrivee *) b;
+	if( a1->lettre != a2->lettre ){
+		return a1->lettre < a2->lettre ? -1 : 1;
+	}
+	return ( a1->fin > a2->fin ) - ( a1->fin < a2->fin );
+}
+
+void noter_arrivee( int origine, char lettre, int fin, void* data ){
+	Ouvrier * ouvrier = (Ouvrier *) data;
+	if( ouvrier->nb_arrivees == ouvrier->capacite_arrivees ){
+		size_t capacite = 2 * ouvrier->capacite_arrivees + 16;
+		Arrivee * arrivees = xmalloc( capacite * sizeof( Arrivee ) );
+		memcpy( arrivees, ouvrier->arrivees, ouvrier->nb_arrivees * sizeof( Arrivee ) );
+		xfree( ouvrier->arrivees );
+		ouvrier->arrivees = arrivees;
+		ouvrier->capacite_arrivees = capacite;
+	}
+	ouvrier->arrivees[ ouvrier->nb_arrivees ].lettre = lettre;
+	ouvrier->arrivees[ ouvrier->nb_arrivees ].fin = fin;
+	ouvrier->nb_arrivees++;
+}
+
+/*
+ * Calcule les successeurs du sous-ensemble pour chaque lettre.
+ *
+ * Les transitions qui partent des états du sous-ensemble sont triées par 
+ * lettre puis par état d'arrivée : les états d'arrivée d'une même lettre 
+ * sont alors contigus et forment, une fois les doublons retirés, le 
+ * sous-ensemble successeur pour cette lettre.
+ */
+void explorer_sous_ensemble( Ouvrier * ouvrier, Sous_ensemble * sous_ensemble ){
+	Determinisation * d = ouvrier->determinisation;
+	size_t i, j;
+	ouvrier->nb_arrivees = 0;
+	for( i=0; i<sous_ensemble->nb; i++ ){
+		pour_toute_transition_depuis( 
+			d->automate, sous_ensemble->etats[i], noter_arrivee, ouvrier 
+		);
+	}
+	qsort( 
+		ouvrier->arrivees, ouvrier->nb_arrivees, sizeof( Arrivee ), 
+		comparer_arrivees 
+	);
+	if( ouvrier->capacite_successeur < ouvrier->nb_arrivees ){
+		xfree( ouvrier->successeur );
+		ouvrier->capacite_successeur = ouvrier->capacite_arrivees;
+		ouvrier->successeur = allouer_sous_ensemble( ouvrier->capacite_successeur );
+	}
+	Sous_ensemble * successeur = ouvrier->successeur;
+	for( i=0; i<ouvrier->nb_arrivees; i=j ){
+		char lettre = ouvrier->arrivees[i].lettre;
+		successeur->nb = 0;
+		for( j=i; j<ouvrier->nb_arrivees && ouvrier->arrivees[j].lettre == lettre; j++ ){
+			if( 
+				successeur->nb == 0 
+				|| successeur->etats[ successeur->nb - 1 ] != ouvrier->arrivees[j].fin
+			){
+				successeur->etats[ successeur->nb++ ] = ouvrier->arrivees[j].fin;
+			}
+		}
+		calculer_hachage_sous_ensemble( successeur );
+		Sous_ensemble * fin = interner_sous_ensemble( ouvrier, successeur );
+		if( ! fin ){
+			sous_ensemble->incomplet = 1;
+			continue;
+		}
+		noter_transition_deterministe( ouvrier, sous_ensemble->numero, lettre, fin->numero );
+	}
+}
+
+/*
+ * Prend un sous-ensemble à explorer dans la file de l'ouvrier, ou à défaut 
+ * dans celle d'un autre ouvrier.
+ */
+Sous_ensemble * trouver_travail( Ouvrier * ouvrier ){
+	Determinisation * d = ouvrier->determinisation;
+	Sous_ensemble * res = retirer_sous_ensemble( ouvrier );
+	int moi = ouvrier - d->ouvriers;
+	int i;
+	for( i=1; i<d->nb_ouvriers && ! res; i++ ){
+		res = retirer_sous_ensemble( &d->ouvriers[ ( moi + i ) % d->nb_ouvriers ] );
+	}
+	return res;
+}
+
+int travail_disponible( Determinisation * d ){
+	int o, res = 0;
+	for( o=0; o<d->nb_ouvriers && ! res; o++ ){
+		pthread_mutex_lock( &d->ouvriers[o].verrou );
+		res = ! est_vide( d->ouvriers[o].a_explorer );
+		pthread_mutex_unlock( &d->ouvriers[o].verrou );
+	}
+	return res;
+}
+
+/*
+ * Attend qu'un sous-ensemble soit confié à un ouvrier, ou que tout soit 
+ * exploré. Renvoie 0 dans ce dernier cas.
+ *
+ * L'ouvrier se déclare en attente avant de regarder les files : ou bien il
+ * voit le sous-ensemble confié, ou bien celui qui le confie le voit en 
+ * attente et le réveille.
+ */
+int attendre_travail( Determinisation * d ){
+	int res = 1;
+	pthread_mutex_lock( &d->verrou_attente );
+	atomic_fetch_add( &d->nb_en_attente, 1 );
+	while( 1 ){
+		if( atomic_load( &d->nb_a_explorer ) == 0 ){
+			res = 0;
+			break;
+		}
+		if( travail_disponible( d ) ) break;
+		pthread_cond_wait( &d->travail_disponible, &d->verrou_attente );
+	}
+	atomic_fetch_sub( &d->nb_en_attente, 1 );
+	pthread_mutex_unlock( &d->verrou_attente );
+	return res;
+}
+
+void* travailler( void* data ){
+	Ouvrier * ouvrier = (Ouvrier *) data;
+	Determinisation * d = ouvrier->determinisation;
+	while( 1 ){
+		Sous_ensemble * sous_ensemble = trouver_travail( ouvrier );
+		if( ! sous_ensemble ){
+			if( ! attendre_travail( d ) ) break;
+			continue;
+		}
+		explorer_sous_ensemble( ouvrier, sous_ensemble );
+		if( atomic_fetch_sub( &d->nb_a_explorer, 1 ) == 1 ){
+			// Tout est exploré : les ouvriers en attente peuvent s'arrêter.
+			pthread_mutex_lock( &d->verrou_attente );
+			pthread_cond_broadcast( &d->travail_disponible );
+			pthread_mutex_unlock( &d->verrou_attente );
+		}
+	}
+	return NULL;
+}
+
+void ranger_sous_ensemble_par_numero( const intptr_t cle, intptr_t valeur, void* data ){
+	Sous_ensemble ** par_numero = (Sous_ensemble **) data;
+	Sous_ensemble * sous_ensemble = (Sous_ensemble *) valeur;
+	par_numero[ sous_ensemble->numero ] = sous_ensemble;
+}
+
+void copier_lettre( const intptr_t element, void* data ){
+	ajouter_lettre( (Automate *) data, (char) element );
+}
+
+/*
+ * Construit l'automate déterministe à partir des sous-ensembles et des 
+ * transitions trouvés par les ouvriers, en renumérotant les états dans 
+ * l'ordre d'un parcours en largeur.
+ *
+ * Si 'par_etat' n'est pas NULL, les sous-ensembles, renumérotés, sont 
+ * rangés par état dans un tableau renvoyé dans '*par_etat' : ils sont alors
+ * à la charge de l'appelant.
+ */
+Automate * construire_automate_deterministe( 
+	Determinisation * d, Sous_ensemble *** par_etat 
+){
+	size_t n = atomic_load( &d->nb_sous_ensembles );
+	Automate * res = creer_automate();
+	pour_tout_element( get_alphabet( d->automate ), copier_lettre, res );
+	// Avec un budget nul, même le sous-ensemble initial n'est pas rangé :
+	// l'automate déterministe n'a aucun état.
+	if( n == 0 ){
+		if( par_etat ){
+			*par_etat = xmalloc( sizeof( Sous_ensemble * ) );
+		}
+		return res;
+	}
+	Sous_ensemble ** par_numero = xmalloc( n * sizeof( Sous_ensemble * ) );
+	int p;
+	for( p=0; p<NB_PARTIES_SOUS_ENSEMBLES; p++ ){
+		pour_toute_cle_valeur_table( 
+			d->parties[p].sous_ensembles, ranger_sous_ensemble_par_numero, 
+			par_numero 
+		);
+	}
+
+	// Les transitions sont rangées par origine (tri par dénombrement, qui 
+	// garde l'ordre des lettres de chaque origine).
+	size_t * debuts = xmalloc( ( n + 1 ) * sizeof( size_t ) );
+	memset( debuts, 0, ( n + 1 ) * sizeof( size_t ) );
+	size_t i, j, nb_transitions = 0;
+	int o;
+	for( o=0; o<d->nb_ouvriers; o++ ){
+		for( i=0; i<d->ouvriers[o].nb_transitions; i++ ){
+			debuts[ d->ouvriers[o].transitions[i].origine + 1 ]++;
+		}
+		nb_transitions += d->ouvriers[o].nb_transitions;
+	}
+	for( i=0; i<n; i++ ){
+		debuts[i+1] += debuts[i];
+	}
+	Transition_deterministe * transitions = 
+		xmalloc( ( nb_transitions + 1 ) * sizeof( Transition_deterministe ) );
+	size_t * places = xmalloc( ( n + 1 ) * sizeof( size_t ) );
+	memcpy( places, debuts, ( n + 1 ) * sizeof( size_t ) );
+	for( o=0; o<d->nb_ouvriers; o++ ){
+		for( i=0; i<d->ouvriers[o].nb_transitions; i++ ){
+			Transition_deterministe * t = &d->ouvriers[o].transitions[i];
+			transitions[ places[ t->origine ]++ ] = *t;
+		}
+	}
+
+	// Parcours en largeur depuis l'état initial, numéroté 0.
+	size_t * nouveaux = places;
+	size_t * file = xmalloc( ( n + 1 ) * sizeof( size_t ) );
+	for( i=0; i<n; i++ ){
+		nouveaux[i] = SANS_ETAT;
+	}
+	size_t debut = 0, fin = 0;
+	nouveaux[0] = 0;
+	file[ fin++ ] = 0;
+	while( debut < fin ){
+		size_t etat = file[ debut++ ];
+		for( j = debuts[etat]; j < debuts[etat+1]; j++ ){
+			if( nouveaux[ transitions[j].fin ] == SANS_ETAT ){
+				nouveaux[ transitions[j].fin ] = fin;
+				file[ fin++ ] = transitions[j].fin;
+			}
+		}
+	}
+
+	ajouter_etat_initial( res, 0 );
+	for( i=0; i<fin; i++ ){
+		size_t etat = file[i];
+		ajouter_etat( res, i );
+		if( par_numero[ etat ]->final ){
+			ajouter_etat_final( res, i );
+		}
+		for( j = debuts[etat]; j < debuts[etat+1]; j++ ){
+			ajouter_transition( 
+				res, i, transitions[j].lettre, nouveaux[ transitions[j].fin ] 
+			);
+		}
+	}
+
+	// Tous les sous-ensembles rangés sont accessibles depuis l'état initial.
+	if( par_etat ){
+		for( i=0; i<n; i++ ){
+			par_numero[ file[i] ]->numero = i;
+		}
+		*par_etat = xmalloc( ( n + 1 ) * sizeof( Sous_ensemble * ) );
+		for( i=0; i<n; i++ ){
+			(*par_etat)[i] = par_numero[ file[i] ];
+		}
+	}else{
+		for( i=0; i<n; i++ ){
+			xfree( par_numero[i] );
+		}
+	}
+	xfree( file );
+	xfree( places );
+	xfree( transitions );
+	xfree( debuts );
+	xfree( par_numero );
+	return res;
+}
+
+/*
+ * Déterminise un automate sans epsilon transition avec 'nb_ouvriers' 
+ * ouvriers. Avec un seul ouvrier, aucun thread n'est créé.
+ *
+ * Au plus 'nb_etats_max' sous-ensembles sont construits : au-delà, les 
+ * transitions vers de nouveaux sous-ensembles sont abandonnées et 
+ * '*budget_depasse' (si 'budget_depasse' n'est pas NULL) est mis à 1.
+ * 'par_etat' a le même rôle que pour construire_automate_deterministe().
+ */
+Automate * determiniser( 
+	const Automate * automate, int nb_ouvriers, size_t nb_etats_max,
+	Sous_ensemble *** par_etat, int * budget_depasse
+){
+	Determinisation d;
+	d.automate = automate;
+	d.nb_sous_ensembles_max = nb_etats_max;
+	atomic_init( &d.budget_depasse, 0 );
+	atomic_init( &d.nb_sous_ensembles, 0 );
+	atomic_init( &d.nb_a_explorer, 0 );
+	atomic_init( &d.nb_en_attente, 0 );
+	pthread_mutex_init( &d.verrou_attente, NULL );
+	pthread_cond_init( &d.travail_disponible, NULL );
+	int p;
+	for( p=0; p<NB_PARTIES_SOUS_ENSEMBLES; p++ ){
+		pthread_mutex_init( &d.parties[p].verrou, NULL );
+		d.parties[p].sous_ensembles = creer_table_hachage(
+			comparer_sous_ensembles, NULL, NULL, hacher_sous_ensemble
+		);
+	}
+
+	d.nb_ouvriers = nb_ouvriers;
+	d.ouvriers = xmalloc( nb_ouvriers * sizeof( Ouvrier ) );
+	int o;
+	for( o=0; o<nb_ouvriers; o++ ){
+		Ouvrier * ouvrier = &d.ouvriers[o];
+		ouvrier->determinisation = &d;
+		pthread_mutex_init( &ouvrier->verrou, NULL );
+		ouvrier->a_explorer = creer_fifo();
+		ouvrier->transitions = NULL;
+		ouvrier->nb_transitions = 0;
+		ouvrier->capacite_transitions = 0;
+		ouvrier->arrivees = NULL;
+		ouvrier->nb_arrivees = 0;
+		ouvrier->capacite_arrivees = 0;
+		ouvrier->successeur = NULL;
+		ouvrier->capacite_successeur = 0;
+	}
+
+	// L'état initial est le premier sous-ensemble rangé : il a le numéro 0.
+	// Le curseur parcourt les états initiaux par ordre croissant.
+	Sous_ensemble * initial = allouer_sous_ensemble( 
+		taille_ensemble( get_initiaux( automate ) ) 
+	);
+	Ensemble_curseur it;
+	for(
+		placer_curseur_ensemble( &it, get_initiaux( automate ) );
+		! curseur_ensemble_est_vide( &it );
+		avancer_curseur_ensemble( &it )
+	){
+		initial->etats[ initial->nb++ ] = element_du_curseur( &it );
+	}
+	calculer_hachage_sous_ensemble( initial );
+	interner_sous_ensemble( &d.ouvriers[0], initial );
+	xfree( initial );
+
+	if( nb_ouvriers == 1 ){
+		travailler( &d.ouvriers[0] );
+	}else{
+		pthread_t * threads = xmalloc( nb_ouvriers * sizeof( pthread_t ) );
+		for( o=0; o<nb_ouvriers; o++ ){
+			if( pthread_create( &threads[o], NULL, travailler, &d.ouvriers[o] ) ){
+				ERREUR( "Impossible de créer un thread." );
+			}
+		}
+		for( o=0; o<nb_ouvriers; o++ ){
+			pthread_join( threads[o], NULL );
+		}
+		xfree( threads );
+	}
+
+	if( budget_depasse ){
+		*budget_depasse = atomic_load( &d.budget_depasse );
+	}
+	Automate * res = construire_automate_deterministe( &d, par_etat );
+
+	for( o=0; o<nb_ouvriers; o++ ){
+		pthread_mutex_destroy( &d.ouvriers[o].verrou );
+		liberer_fifo( d.ouvriers[o].a_explorer );
+		xfree( d.ouvriers[o].transitions );
+		xfree( d.ouvriers[o].arrivees );
+		xfree( d.ouvriers[o].successeur );
+	}
+	xfree( d.ouvriers );
+	for( p=0; p<NB_PARTIES_SOUS_ENSEMBLES; p++ ){
+		pthread_mutex_destroy( &d.parties[p].verrou );
+		liberer_table( d.parties[p].sous_ensembles );
+	}
+	pthread_cond_destroy( &d.travail_disponible );
+	pthread_mutex_destroy( &d.verrou_attente );
+	return res;
+}
+
+/*
+ * Déterminise l'automate, après avoir retiré ses epsilon transitions s'il 
+ * en a.
+ */
+Automate * determiniser_sans_epsilon( const Automate * automate, int nb_ouvriers ){
+	if( ! a_des_epsilon_transitions( automate ) ){
+		return determiniser( automate, nb_ouvriers, SANS_ETAT, NULL, NULL );
+	}
+	Automate * sans_epsilon = creer_automate_sans_epsilon( automate );
+	Automate * res = determiniser( sans_epsilon, nb_ouvriers, SANS_ETAT, NULL, NULL );
+	liberer_automate( sans_epsilon );
+	return res;
+}
+
+Automate * creer_automate_deterministe( const Automate* automate ){
+	return determiniser_sans_epsilon( automate, 1 );
+}
+
+Automate * creer_automate_deterministe_parallele( 
+	const Automate* automate, int nb_threads 
+){
+	if( nb_threads <= 0 ){
+		nb_threads = (int) sysconf( _SC_NPROCESSORS_ONLN );
+		if( nb_threads <= 0 ){
+			nb_threads = 1;
+		}
+	}
+	return determiniser_sans_epsilon( automate, nb_threads );
+}
+
+/*
+ * Numérotation des lettres d'un alphabet : indices[ (unsigned char) lettre ]
+ * vaut -1 pour une lettre hors de l'alphabet.
+ */
+typedef struct {
+	int indices[ 256 ];
+	size_t nb;
+} Lettres_indexees;
+
+void indexer_lettre( const intptr_t element, void* data ){
+	Lettres_indexees * lettres = (Lettres_indexees *) data;
+	lettres->indices[ (unsigned char) element ] = lettres->nb++;
+}
+
+void indexer_lettres( Lettres_indexees * lettres, const Automate * automate ){
+	int i;
+	for( i=0; i<256; i++ ){
+		lettres->indices[i] = -1;
+	}
+	lettres->nb = 0;
+	pour_tout_element( get_alphabet( automate ), indexer_lettre, lettres );
+}
+
+/*
+ * Agrandit si besoin le sous-ensemble '*sous_ensemble' pour qu'il puisse 
+ * contenir 'nb' états, sans conserver son contenu.
+ */
+void reserver_sous_ensemble( 
+	Sous_ensemble ** sous_ensemble, size_t * capacite, size_t nb 
+){
+	if( *capacite < nb || ! *sous_ensemble ){
+		xfree( *sous_ensemble );
+		*capacite = 2 * nb + 1;
+		*sous_ensemble = allouer_sous_ensemble( *capacite );
+	}
+}
+
+int comparer_etats( const void * a, const void * b ){
+	int e1 = *(const int *) a;
+	int e2 = *(const int *) b;
+	return ( e1 > e2 ) - ( e1 < e2 );
+}
+
+/*
+ * Range dans '*successeur', agrandi si besoin, le sous-ensemble des états 
+ * accessibles depuis 'depart' en lisant la lettre, et calcule sa valeur de 
+ * hachage. Le champ 'final' n'est pas calculé.
+ */
+void calculer_successeur(
+	const Automate * automate, const Sous_ensemble * depart, char lettre,
+	Sous_ensemble ** successeur, size_t * capacite
+){
+	size_t i, nb = 0;
+	for( i=0; i<depart->nb; i++ ){
+		nb += taille_ensemble( voisins( automate, depart->etats[i], lettre ) );
+	}
+	reserver_sous_ensemble( successeur, capacite, nb );
+	Sous_ensemble * res = *successeur;
+	res->nb = 0;
+	Ensemble_curseur it;
+	for( i=0; i<depart->nb; i++ ){
+		for(
+			placer_curseur_ensemble( 
+				&it, voisins( automate, depart->etats[i], lettre ) 
+			);
+			! curseur_ensemble_est_vide( &it );
+			avancer_curseur_ensemble( &it )
+		){
+			res->etats[ res->nb++ ] = element_du_curseur( &it );
+		}
+	}
+	if( res->nb > 1 ){
+		qsort( res->etats, res->nb, sizeof( int ), comparer_etats );
+		nb = 1;
+		for( i=1; i<res->nb; i++ ){
+			if( res->etats[i] != res->etats[nb-1] ){
+				res->etats[nb++] = res->etats[i];
+			}
+		}
+		res->nb = nb;
+	}
+	calculer_hachage_sous_ensemble( res );
+}
+
+/*
+ * Renvoie 1 si le sous-ensemble contient un état final de l'automate.
+ */
+int contient_un_etat_final( 
+	const Automate * automate, const Sous_ensemble * sous_ensemble 
+){
+	size_t i;
+	for( i=0; i<sous_ensemble->nb; i++ ){
+		if( est_un_etat_final_de_l_automate( automate, sous_ensemble->etats[i] ) ){
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Reconnaisseur hybride : l'automate déterministe est construit dans la 
+ * limite du budget, et ses transitions sont rangées dans un tableau indexé
+ * par état et par lettre. Quand une transition manque depuis un sous-ensemble
+ * incomplet, la lecture continue en simulant l'automate non déterministe à 
+ * partir de ce sous-ensemble, jusqu'à retomber sur un sous-ensemble déjà 
+ * construit.
+ */
+struct _Reconnaisseur {
+	// L'automate de départ, sans epsilon transition.
+	Automate * automate;
+	Automate * deterministe;
+	size_t nb_etats;
+	// Le sous-ensemble de chaque état de l'automate déterministe, et la 
+	// table qui retrouve un état à partir de son sous-ensemble.
+	Sous_ensemble ** sous_ensembles;
+	Table * etats;
+	Lettres_indexees lettres;
+	// suivants[ etat * lettres.nb + indice de la lettre ], ou SANS_ETAT.
+	size_t * suivants;
+	// Les sous-ensembles de la simulation.
+	Sous_ensemble * courant;
+	Sous_ensemble * suivant;
+	size_t capacite_courant;
+	size_t capacite_suivant;
+	Statistiques_reconnaisseur statistiques;
+};
+
+void noter_suivant( int origine, char lettre, int fin, void* data ){
+	Reconnaisseur * reconnaisseur = (Reconnaisseur *) data;
+	reconnaisseur->suivants[ 
+		origine * reconnaisseur->lettres.nb 
+		+ reconnaisseur->lettres.indices[ (unsigned char) lettre ] 
+	] = fin;
+}
+
+Reconnaisseur * creer_reconnaisseur( const Automate* automate, size_t nb_etats_max ){
+	Reconnaisseur * res = xmalloc( sizeof( Reconnaisseur ) );
+	if( a_des_epsilon_transitions( automate ) ){
+		res->automate = creer_automate_sans_epsilon( automate );
+	}else{
+		res->automate = copier_automate( automate );
+	}
+	int budget_depasse;
+	res->deterministe = determiniser( 
+		res->automate, 1, nb_etats_max ? nb_etats_max : SANS_ETAT,
+		&res->sous_ensembles, &budget_depasse
+	);
+	res->nb_etats = taille_ensemble( get_etats( res->deterministe ) );
+
+	res->etats = creer_table_hachage(
+		comparer_sous_ensembles, NULL, NULL, hacher_sous_ensemble
+	);
+	size_t i;
+	for( i=0; i<res->nb_etats; i++ ){
+		add_table( 
+			res->etats, (intptr_t) res->sous_ensembles[i], 
+			(intptr_t) res->sous_ensembles[i] 
+		);
+	}
+
+	indexer_lettres( &res->lettres, res->automate );
+	res->suivants = xmalloc( 
+		( res->nb_etats * res->lettres.nb + 1 ) * sizeof( size_t ) 
+	);
+	for( i=0; i < res->nb_etats * res->lettres.nb; i++ ){
+		res->suivants[i] = SANS_ETAT;
+	}
+	pour_toute_transition( res->deterministe, noter_suivant, res );
+
+	res->courant = NULL;
+	res->suivant = NULL;
+	res->capacite_courant = 0;
+	res->capacite_suivant = 0;
+
+	memset( &res->statistiques, 0, sizeof( Statistiques_reconnaisseur ) );
+	res->statistiques.nb_etats = res->nb_etats;
+	res->statistiques.budget_depasse = budget_depasse;
+	return res;
+}
+
+void liberer_reconnaisseur( Reconnaisseur * reconnaisseur ){
+	if( ! reconnaisseur ) return;
+	size_t i;
+	for( i=0; i<reconnaisseur->nb_etats; i++ ){
+		xfree( reconnaisseur->sous_ensembles[i] );
+	}
+	xfree( reconnaisseur->sous_ensembles );
+	liberer_table( reconnaisseur->etats );
+	xfree( reconnaisseur->suivants );
+	xfree( reconnaisseur->courant );
+	xfree( reconnaisseur->suivant );
+	liberer_automate( reconnaisseur->deterministe );
+	liberer_automate( reconnaisseur->automate );
+	xfree( reconnaisseur );
+}
+
+/*
+ * Remplace le sous-ensemble courant de la simulation par ses successeurs 
+ * pour la lettre.
+ */
+void simuler_lettre( Reconnaisseur * r, char lettre ){
+	calculer_successeur( 
+		r->automate, r->courant, lettre, &r->suivant, &r->capacite_suivant 
+	);
+	Sous_ensemble * suivant = r->suivant;
+	r->suivant = r->courant;
+	r->courant = suivant;
+	size_t capacite = r->capacite_suivant;
+	r->capacite_suivant = r->capacite_courant;
+	r->capacite_courant = capacite;
+}
+
+int reconnaitre_mot( Reconnaisseur * reconnaisseur, const char * mot ){
+	Reconnaisseur * r = reconnaisseur;
+	r->statistiques.nb_mots++;
+	size_t etat = 0;
+	int simulation = 0;
+	int a_simule = 0;
+	for( ; *mot; mot++ ){
+		int lettre = r->lettres.indices[ (unsigned char) *mot ];
+		if( lettre < 0 ) return 0;
+		if( ! simulation ){
+			size_t suivant = r->suivants[ etat * r->lettres.nb + lettre ];
+			if( suivant != SANS_ETAT ){
+				etat = suivant;
+				continue;
+			}
+			if( ! r->sous_ensembles[etat]->incomplet ) return 0;
+
+			// La transition n'a pas été construite : la lecture continue 
+			// sur l'automate non déterministe.
+			Sous_ensemble * depart = r->sous_ensembles[etat];
+			reserver_sous_ensemble( &r->courant, &r->capacite_courant, depart->nb );
+			memcpy( r->courant->etats, depart->etats, depart->nb * sizeof( int ) );
+			r->courant->nb = depart->nb;
+			simulation = 1;
+			if( ! a_simule ){
+				a_simule = 1;
+				r->statistiques.nb_mots_simules++;
+			}
+		}
+		r->statistiques.nb_lettres_simulees++;
+		simuler_lettre( r, *mot );
+		if( r->courant->nb == 0 ) return 0;
+
+		const intptr_t * connu = chercher_valeur_table( 
+			r->etats, (intptr_t) r->courant 
+		);
+		if( connu ){
+			etat = ( (Sous_ensemble *) *connu )->numero;
+			simulation = 0;
+			r->statistiques.nb_retours_deterministe++;
+		}
+	}
+	if( ! simulation ){
+		return r->sous_ensembles[etat]->final;
+	}
+	return contient_un_etat_final( r->automate, r->courant );
+}
+
+const Automate * get_automate_deterministe( const Reconnaisseur * reconnaisseur ){
+	return reconnaisseur->deterministe;
+}
+
+Statistiques_reconnaisseur get_statistiques_reconnaisseur( 
+	const Reconnaisseur * reconnaisseur 
+){
+	return reconnaisseur->statistiques;
+}
+
+/*
+ * Cache déterministe paresseux, partagé entre threads.
+ *
+ * Un état du cache est un sous-ensemble d'états de l'automate et un tableau
+ * de successeurs, un par lettre, qui valent NULL tant qu'ils n'ont pas été 
+ * calculés. Les successeurs sont lus et écrits de manière atomique : un 
+ * thread qui suit une transition déjà calculée ne prend aucun verrou. 
+ * Calculer une transition manquante cherche (ou range) son sous-ensemble 
+ * d'arrivée dans un ensemble découpé en parties, chacune protégée par son 
+ * verrou. Deux threads qui calculent la même transition trouvent le même 
+ * état et écrivent donc la même valeur.
+ *
+ * Les états ne sont libérés que lors d'un vidage du cache, quand la mémoire
+ * occupée (les états, et l'agrandissement des tables des parties) a atteint 
+ * son maximum. Une lecture qui ne peut plus ranger de nouvel état continue 
+ * en simulant l'automate, sans plus chercher d'état dans le cache, et 
+ * demande un vidage, fait une fois sa lecture terminée.
+ *
+ * Le vidage doit attendre la fin des lectures en cours. Une lecture ne 
+ * prend pour cela aucun verrou : elle incrémente, puis décrémente, le 
+ * compteur de lectures associé à son thread. Les compteurs sont répartis 
+ * sur des lignes de cache distinctes, et deux threads ne partagent un 
+ * compteur que s'il y a plus de NB_COMPTEURS_LECTURES threads. Le vidage 
+ * annonce qu'il commence ('vidage_en_cours'), puis attend que tous les 
+ * compteurs soient nuls ; une lecture qui commence pendant un vidage se 
+ * retire et attend qu'il soit terminé.
+ */
+typedef struct _Etat_paresseux Etat_paresseux;
+
+/* Taille d'une ligne de cache, en octets. */
+#define LIGNE_CACHE 64
+
+/*
+ * Nombre de compteurs de lectures d'un cache déterministe.
+ */
+#define NB_COMPTEURS_LECTURES 64
+
+/*
+ * Compteurs propres à un thread (ou à quelques threads), seuls sur leur 
+ * ligne de cache : les statistiques par mot ou par lettre y sont aussi 
+ * comptées, pour ne pas écrire dans une ligne partagée par tous les threads.
+ *
+ * Les deux sous-ensembles de travail de la simulation (voir 
+ * lire_mot_dans_le_cache()) sont gardés d'un mot à l'autre. Un thread ne 
+ * s'en sert que s'il a pu mettre 'tampons_pris' à 1 : sinon, un autre 
+ * thread du même compteur lit un mot, et la lecture utilise des 
+ * sous-ensembles temporaires.
+ */
+typedef struct {
+	_Alignas( LIGNE_CACHE ) atomic_size_t nb_lectures_en_cours;
+	atomic_size_t nb_mots;
+	atomic_size_t nb_lettres_simulees;
+	atomic_int tampons_pris;
+	Sous_ensemble * tampons[2];
+	size_t capacites[2];
+} Compteur_lectures;
+
+/*
+ * Numéro du thread courant parmi ceux qui ont lu un mot sur un cache 
+ * déterministe, à partir de 1 (0 : pas encore numéroté).
+ */
+_Thread_local size_t numero_lecteur = 0;
+atomic_size_t nb_lecteurs_numerotes = 0;
+
+struct _Etat_paresseux {
+	Sous_ensemble * sous_ensemble;
+	_Atomic( Etat_paresseux * ) suivants[];
+};
+
+struct _Cache_deterministe {
+	// L'automate de départ, sans epsilon transition.
+	Automate * automate;
+	Lettres_indexees lettres;
+	Compteur_lectures compteurs[ NB_COMPTEURS_LECTURES ];
+	atomic_int vidage_en_cours;
+	// Protège le vidage, et les attentes de la fin des lectures ou du 
+	// vidage.
+	pthread_mutex_t verrou_vidage;
+	pthread_cond_t lectures_terminees;
+	pthread_cond_t vidage_termine;
+	Partie_sous_ensembles parties[ NB_PARTIES_SOUS_ENSEMBLES ];
+	Etat_paresseux * initial;
+	// Successeur commun de toutes les transitions vers le sous-ensemble vide.
+	Etat_paresseux * mort;
+	atomic_size_t memoire;
+	size_t memoire_max;
+	atomic_int vidage_demande;
+	atomic_size_t nb_etats;
+	atomic_size_t nb_transitions_calculees;
+	atomic_size_t nb_vidages;
+};
+
+size_t taille_etat_paresseux( const Cache_deterministe * cache, size_t nb ){
+	return sizeof( Etat_paresseux ) 
+		+ cache->lettres.nb * sizeof( Etat_paresseux * )
+		+ sizeof( Sous_ensemble ) + nb * sizeof( int );
+}
+
+Etat_paresseux * allouer_etat_paresseux( 
+	const Cache_deterministe * cache, const Sous_ensemble * sous_ensemble 
+){
+	Etat_paresseux * res = xmalloc( 
+		sizeof( Etat_paresseux ) + cache->lettres.nb * sizeof( Etat_paresseux * )
+	);
+	size_t l;
+	for( l=0; l<cache->lettres.nb; l++ ){
+		atomic_init( &res->suivants[l], NULL );
+	}
+	res->sous_ensemble = allouer_sous_ensemble( sous_ensemble->nb );
+	memcpy( 
+		res->sous_ensemble, sous_ensemble, 
+		sizeof( Sous_ensemble ) + sous_ensemble->nb * sizeof( int ) 
+	);
+	res->sous_ensemble->final = 
+		contient_un_etat_final( cache->automate, sous_ensemble );
+	return res;
+}
+
+void liberer_etat_paresseux( Etat_paresseux * etat ){
+	xfree( etat->sous_ensemble );
+	xfree( etat );
+}
+
+/*
+ * Renvoie l'état du cache dont le sous-ensemble est égal à celui passé en 
+ * paramètre. S'il n'y en a pas, l'état est créé si la mémoire le permet (ou
+ * si 'forcer' est vrai) ; sinon, un vidage est demandé et la fonction 
+ * renvoie NULL.
+ *
+ * L'agrandissement de la table de la partie est compté dans la mémoire du 
+ * cache, après coup.
+ */
+Etat_paresseux * etat_du_cache( 
+	Cache_deterministe * cache, const Sous_ensemble * sous_ensemble, int forcer 
+){
+	Partie_sous_ensembles * partie = &cache->parties[ 
+		( sous_ensemble->hachage >> 7 ) % NB_PARTIES_SOUS_ENSEMBLES 
+	];
+	pthread_mutex_lock( &partie->verrou );
+	const intptr_t * connu = chercher_valeur_table( 
+		partie->sous_ensembles, (intptr_t) sous_ensemble 
+	);
+	if( connu ){
+		Etat_paresseux * res = (Etat_paresseux *) *connu;
+		pthread_mutex_unlock( &partie->verrou );
+		return res;
+	}
+	size_t taille = taille_etat_paresseux( cache, sous_ensemble->nb );
+	size_t memoire = atomic_load( &cache->memoire );
+	do{
+		if( ! forcer && memoire + taille > cache->memoire_max ){
+			if( ! atomic_load( &cache->vidage_demande ) ){
+				atomic_store( &cache->vidage_demande, 1 );
+			}
+			pthread_mutex_unlock( &partie->verrou );
+			return NULL;
+		}
+	}while( 
+		! atomic_compare_exchange_weak( &cache->memoire, &memoire, memoire + taille ) 
+	);
+	Etat_paresseux * res = allouer_etat_paresseux( cache, sous_ensemble );
+	size_t memoire_table_avant = memoire_table( partie->sous_ensembles );
+	add_table( 
+		partie->sous_ensembles, (intptr_t) res->sous_ensemble, (intptr_t) res 
+	);
+	size_t croissance = 
+		memoire_table( partie->sous_ensembles ) - memoire_table_avant;
+	pthread_mutex_unlock( &partie->verrou );
+	if( croissance ){
+		atomic_fetch_add( &cache->memoire, croissance );
+	}
+	atomic_fetch_add( &cache->nb_etats, 1 );
+	return res;
+}
+
+void liberer_valeur_etat_paresseux( const intptr_t cle, intptr_t valeur, void* data ){
+	liberer_etat_paresseux( (Etat_paresseux *) valeur );
+}
+
+Table * creer_table_etats_paresseux(){
+	return creer_table_hachage(
+		comparer_sous_ensembles, NULL, NULL, hacher_sous_ensemble
+	);
+}
+
+/*
+ * Libère tous les états du cache, puis recrée l'état initial. Aucune lecture
+ * ne doit être en cours.
+ *
+ * Les tables des parties sont recréées, et non vidées, pour rendre la 
+ * mémoire de leur agrandissement.
+ */
+void vider_etats_du_cache( Cache_deterministe * cache ){
+	int p;
+	for( p=0; p<NB_PARTIES_SOUS_ENSEMBLES; p++ ){
+		pour_toute_cle_valeur_table( 
+			cache->parties[p].sous_ensembles, liberer_valeur_etat_paresseux, NULL
+		);
+		liberer_table( cache->parties[p].sous_ensembles );
+		cache->parties[p].sous_ensembles = creer_table_etats_paresseux();
+	}
+	atomic_store( &cache->memoire, 0 );
+	atomic_store( &cache->nb_etats, 0 );
+
+	// Le cache contient toujours son état initial.
+	Sous_ensemble * initial = allouer_sous_ensemble( 
+		taille_ensemble( get_initiaux( cache->automate ) ) 
+	);
+	Ensemble_curseur it;
+	for(
+		placer_curseur_ensemble( &it, get_initiaux( cache->automate ) );
+		! curseur_ensemble_est_vide( &it );
+		avancer_curseur_ensemble( &it )
+	){
+		initial->etats[ initial->nb++ ] = element_du_curseur( &it );
+	}
+	calculer_hachage_sous_ensemble( initial );
+	cache->initial = etat_du_cache( cache, initial, 1 );
+	xfree( initial );
+	atomic_store( &cache->vidage_demande, 0 );
+}
+
+Cache_deterministe * creer_cache_deterministe( 
+	const Automate* automate, size_t memoire_max 
+){
+	// Les compteurs de lectures doivent commencer chacun une ligne de cache.
+	Cache_deterministe * res = aligned_alloc( 
+		LIGNE_CACHE, sizeof( Cache_deterministe ) 
+	);
+	if( ! res ){
+		ERREUR( "Espace insuffisant" );
+	}
+	if( a_des_epsilon_transitions( automate ) ){
+		res->automate = creer_automate_sans_epsilon( automate );
+	}else{
+		res->automate = copier_automate( automate );
+	}
+	indexer_lettres( &res->lettres, res->automate );
+	int i;
+	for( i=0; i<NB_COMPTEURS_LECTURES; i++ ){
+		atomic_init( &res->compteurs[i].nb_lectures_en_cours, 0 );
+		atomic_init( &res->compteurs[i].nb_mots, 0 );
+		atomic_init( &res->compteurs[i].nb_lettres_simulees, 0 );
+		atomic_init( &res->compteurs[i].tampons_pris, 0 );
+		res->compteurs[i].tampons[0] = NULL;
+		res->compteurs[i].tampons[1] = NULL;
+		res->compteurs[i].capacites[0] = 0;
+		res->compteurs[i].capacites[1] = 0;
+	}
+	atomic_init( &res->vidage_en_cours, 0 );
+	pthread_mutex_init( &res->verrou_vidage, NULL );
+	pthread_cond_init( &res->lectures_terminees, NULL );
+	pthread_cond_init( &res->vidage_termine, NULL );
+	int p;
+	for( p=0; p<NB_PARTIES_SOUS_ENSEMBLES; p++ ){
+		pthread_mutex_init( &res->parties[p].verrou, NULL );
+		res->parties[p].sous_ensembles = creer_table_etats_paresseux();
+	}
+	Sous_ensemble vide;
+	vide.hachage = 0;
+	vide.nb = 0;
+	res->mort = allouer_etat_paresseux( res, &vide );
+	res->memoire_max = memoire_max ? memoire_max : (size_t) -1;
+	atomic_init( &res->memoire, 0 );
+	atomic_init( &res->vidage_demande, 0 );
+	atomic_init( &res->nb_etats, 0 );
+	atomic_init( &res->nb_transitions_calculees, 0 );
+	atomic_init( &res->nb_vidages, 0 );
+	vider_etats_du_cache( res );
+	return res;
+}
+
+void liberer_cache_deterministe( Cache_deterministe * cache ){
+	if( ! cache ) return;
+	int p;
+	for( p=0; p<NB_PARTIES_SOUS_ENSEMBLES; p++ ){
+		pour_toute_cle_valeur_table( 
+			cache->parties[p].sous_ensembles, liberer_valeur_etat_paresseux, NULL
+		);
+		liberer_table( cache->parties[p].sous_ensembles );
+		pthread_mutex_destroy( &cache->parties[p].verrou );
+	}
+	liberer_etat_paresseux( cache->mort );
+	int i;
+	for( i=0; i<NB_COMPTEURS_LECTURES; i++ ){
+		xfree( cache->compteurs[i].tampons[0] );
+		xfree( cache->compteurs[i].tampons[1] );
+	}
+	pthread_cond_destroy( &cache->vidage_termine );
+	pthread_cond_destroy( &cache->lectures_terminees );
+	pthread_mutex_destroy( &cache->verrou_vidage );
+	liberer_automate( cache->automate );
+	xfree( cache );
+}
+
+/*
+ * Renvoie le compteur de lectures du thread courant.
+ */
+Compteur_lectures * compteur_du_thread( Cache_deterministe * cache ){
+	if( ! numero_lecteur ){
+		numero_lecteur = atomic_fetch_add( &nb_lecteurs_numerotes, 1 ) + 1;
+	}
+	return &cache->compteurs[ numero_lecteur % NB_COMPTEURS_LECTURES ];
+}
+
+void terminer_lecture( 
+	Cache_deterministe * cache, Compteur_lectures * compteur 
+){
+	atomic_fetch_sub( &compteur->nb_lectures_en_cours, 1 );
+	// Ou bien le vidage voit le compteur décrémenté, ou bien la lecture voit
+	// que le vidage a commencé, et le réveille.
+	if( atomic_load( &cache->vidage_en_cours ) ){
+		pthread_mutex_lock( &cache->verrou_vidage );
+		pthread_cond_broadcast( &cache->lectures_terminees );
+		pthread_mutex_unlock( &cache->verrou_vidage );
+	}
+}
+
+void commencer_lecture( 
+	Cache_deterministe * cache, Compteur_lectures * compteur 
+){
+	for(;;){
+		atomic_fetch_add( &compteur->nb_lectures_en_cours, 1 );
+		if( ! atomic_load( &cache->vidage_en_cours ) ) return;
+		terminer_lecture( cache, compteur );
+		pthread_mutex_lock( &cache->verrou_vidage );
+		while( atomic_load( &cache->vidage_en_cours ) ){
+			pthread_cond_wait( &cache->vidage_termine, &cache->verrou_vidage );
+		}
+		pthread_mutex_unlock( &cache->verrou_vidage );
+	}
+}
+
+int lectures_en_cours( Cache_deterministe * cache ){
+	int i;
+	for( i=0; i<NB_COMPTEURS_LECTURES; i++ ){
+		if( atomic_load( &cache->compteurs[i].nb_lectures_en_cours ) ){
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Vide le cache si un vidage a été demandé, une fois les lectures en cours
+ * terminées. Le thread courant ne doit pas être en train de lire.
+ */
+void vider_cache_si_demande( Cache_deterministe * cache ){
+	pthread_mutex_lock( &cache->verrou_vidage );
+	// Le verrou est relâché pendant qu'un vidage attend la fin des lectures :
+	// un seul vidage à la fois.
+	while( atomic_load( &cache->vidage_en_cours ) ){
+		pthread_cond_wait( &cache->vidage_termine, &cache->verrou_vidage );
+	}
+	// Un autre thread a pu vider le cache entre temps.
+	if( atomic_load( &cache->vidage_demande ) ){
+		atomic_store( &cache->vidage_en_cours, 1 );
+		while( lectures_en_cours( cache ) ){
+			pthread_cond_wait( &cache->lectures_terminees, &cache->verrou_vidage );
+		}
+		vider_etats_du_cache( cache );
+		atomic_fetch_add( &cache->nb_vidages, 1 );
+		atomic_store( &cache->vidage_en_cours, 0 );
+		pthread_cond_broadcast( &cache->vidage_termine );
+	}
+	pthread_mutex_unlock( &cache->verrou_vidage );
+}
+
+/*
+ * Lit le mot sur le cache, entre commencer_lecture() et terminer_lecture().
+ * 'tampons' et 'capacites' sont deux sous-ensembles de travail, agrandis si
+ * besoin.
+ */
+int lire_mot_dans_le_cache( 
+	Cache_deterministe * cache, Compteur_lectures * compteur, const char * mot, 
+	Sous_ensemble * tampons[2], size_t capacites[2] 
+){
+	Etat_paresseux * etat = cache->initial;
+	// Quand 'etat' vaut NULL, la lecture simule l'automate depuis le 
+	// sous-ensemble tampons[0].
+	for( ; *mot; mot++ ){
+		int lettre = cache->lettres.indices[ (unsigned char) *mot ];
+		if( lettre < 0 ) return 0;
+		if( etat ){
+			Etat_paresseux * suivant = atomic_load_explicit( 
+				&etat->suivants[ lettre ], memory_order_acquire 
+			);
+			if( ! suivant ){
+				atomic_fetch_add( &cache->nb_transitions_calculees, 1 );
+				calculer_successeur( 
+					cache->automate, etat->sous_ensemble, *mot, 
+					&tampons[0], &capacites[0] 
+				);
+				if( tampons[0]->nb == 0 ){
+					suivant = cache->mort;
+				}else{
+					suivant = etat_du_cache( cache, tampons[0], 0 );
+				}
+				if( suivant ){
+					atomic_store_explicit( 
+						&etat->suivants[ lettre ], suivant, memory_order_release 
+					);
+				}
+			}
+			if( suivant == cache->mort ) return 0;
+			etat = suivant;
+		}else{
+			atomic_fetch_add_explicit( 
+				&compteur->nb_lettres_simulees, 1, memory_order_relaxed 
+			);
+			calculer_successeur( 
+				cache->automate, tampons[0], *mot, &tampons[1], &capacites[1] 
+			);
+			Sous_ensemble * tampon = tampons[0];
+			tampons[0] = tampons[1];
+			tampons[1] = tampon;
+			size_t capacite = capacites[0];
+			capacites[0] = capacites[1];
+			capacites[1] = capacite;
+			if( tampons[0]->nb == 0 ) return 0;
+			// Tant que le vidage demandé n'est pas fait, le cache est plein :
+			// inutile d'y chercher le sous-ensemble à chaque lettre.
+			if( ! atomic_load_explicit( 
+				&cache->vidage_demande, memory_order_relaxed 
+			) ){
+				etat = etat_du_cache( cache, tampons[0], 0 );
+			}
+		}
+	}
+	if( etat ){
+		return etat->sous_ensemble->final;
+	}
+	return contient_un_etat_final( cache->automate, tampons[0] );
+}
+
+int reconnaitre_mot_avec_cache( Cache_deterministe * cache, const char * mot ){
+	Compteur_lectures * compteur = compteur_du_thread( cache );
+	atomic_fetch_add_explicit( &compteur->nb_mots, 1, memory_order_relaxed );
+	Sous_ensemble * temporaires[2] = { NULL, NULL };
+	size_t capacites_temporaires[2] = { 0, 0 };
+	int tampons_du_compteur = 
+		! atomic_exchange( &compteur->tampons_pris, 1 );
+	Sous_ensemble ** tampons = 
+		tampons_du_compteur ? compteur->tampons : temporaires;
+	size_t * capacites = 
+		tampons_du_compteur ? compteur->capacites : capacites_temporaires;
+
+	commencer_lecture( cache, compteur );
+	int res = lire_mot_dans_le_cache( cache, compteur, mot, tampons, capacites );
+	terminer_lecture( cache, compteur );
+
+	if( tampons_du_compteur ){
+		atomic_store( &compteur->tampons_pris, 0 );
+	}else{
+		xfree( temporaires[0] );
+		xfree( temporaires[1] );
+	}
+
+	if( atomic_load( &cache->vidage_demande ) ){
+		vider_cache_si_demande( cache );
+	}
+	return res;
+}
+
+Statistiques_cache_deterministe get_statistiques_cache_deterministe(
+	const Cache_deterministe * cache
+){
+	Statistiques_cache_deterministe res;
+	res.nb_etats = atomic_load( &cache->nb_etats );
+	res.memoire = atomic_load( &cache->memoire );
+	res.nb_mots = 0;
+	res.nb_lettres_simulees = 0;
+	int i;
+	for( i=0; i<NB_COMPTEURS_LECTURES; i++ ){
+		res.nb_mots += atomic_load( &cache->compteurs[i].nb_mots );
+		res.nb_lettres_simulees += 
+			atomic_load( &cache->compteurs[i].nb_lettres_simulees );
+	}
+	res.nb_transitions_calculees = atomic_load( &cache->nb_transitions_calculees );
+	res.nb_vidages = atomic_load( &cache->nb_vidages );
+	return res;
+}
@@ -24,8 +24,10 @@
 #include "ensemble.h"
 #include "outils.h"
 #include "table.h"
+#include "hachage.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include <stdio.h>
 
 
@@ -34,8 +36,27 @@ struct _Ensemble {
 	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 );
 	intptr_t (*copier_element)( const intptr_t elem );
 	void (*supprimer_element)(intptr_t elem );
+	// Somme des valeurs de hachage des éléments, valide si 'hachage_a_jour'
+	// est vrai (voir hacher_ensemble()).
+	unsigned long hachage;
+	int hachage_a_jour;
 };
 
+/*
+ * Valeur de hachage d'un élément. Deux éléments égaux pour une fonction de 
+ * comparaison fournie par l'utilisateur peuvent avoir des valeurs 
+ * différentes : la valeur de hachage d'un tel ensemble n'est pas tenue à jour
+ * (voir hacher_ensemble()).
+ */
+unsigned long hacher_element_ensemble( 
+	const Ensemble* ensemble, const intptr_t element 
+){
+	if( ensemble->comparer_element ){
+		return 0;
+	}
+	return melanger_hachage( (unsigned long) element );
+}
+
 int* allouer_element( int val ){
 	int* result = (int*) xmalloc( sizeof(int) );
 	(*result) = val;
@@ -46,37 +67,51 @@ void supprimer_element( int* element ){
 	xfree( element );
 }
 
-void next_iterators( Table_iterateur * it1, Table_iterateur * it2 ){
-	*it1 = iterateur_suivant_table(*it1);
-	*it2 = iterateur_suivant_table(*it2);
+void next_iterators( Table_curseur * it1, Table_curseur * it2 ){
+	avancer_curseur_table( it1 );
+	avancer_curseur_table( it2 );
+}
+
+int comparer_elements_ensemble(
+	const Ensemble* ens, const intptr_t elem1, const intptr_t elem2
+){
+	if( ens->comparer_element ){
+		return ens->comparer_element( elem1, elem2 );
+	}
+	if( elem1 < elem2 ) return -1;
+	if( elem1 > elem2 ) return 1;
+	return 0;
 }
 
 int comparer_ensemble( Ensemble* ens1, Ensemble*  ens2 ){
-	Table_iterateur it1, it2;
+	Table_curseur it1, it2;
 	
-	it1 = premier_iterateur_table( ens1->table );
-	it2 = premier_iterateur_table( ens2->table );
+	placer_curseur_table( &it1, ens1->table );
+	placer_curseur_table( &it2, ens2->table );
 	for( 
 		;
-		( ! iterateur_est_vide(it1) ) && ( ! iterateur_est_vide(it2) );
+		( ! curseur_table_est_vide(&it1) ) && ( ! curseur_table_est_vide(&it2) );
 		next_iterators( &it1, &it2 )
 	){
-		int cmp;
-		if( ens1->comparer_element ){
-			cmp = ens1->comparer_element( get_cle( it1 ), get_cle( it2 ) );
-		}else{
-			cmp = get_cle( it1 ) -  get_cle( it2 );
-		}
+		int cmp = comparer_elements_ensemble(
+			ens1, cle_du_curseur_table( &it1 ), cle_du_curseur_table( &it2 )
+		);
 	 	if( cmp > 0 ) return 1;
 	 	if( cmp < 0 ) return -1;
 	}
-	if( iterateur_est_vide(it1) && iterateur_est_vide(it2) )
+	if( curseur_table_est_vide(&it1) && curseur_table_est_vide(&it2) )
 		return 0;
-	if( iterateur_est_vide(it1) ) 
+	if( curseur_table_est_vide(&it1) ) 
 		return -1;
 	return 1;
 }
 
+int ensembles_egaux( const Ensemble* ens1, const Ensemble* ens2 ){
+	if( taille_ensemble( ens1 ) != taille_ensemble( ens2 ) )
+		return 0;
+	return comparer_ensemble( (Ensemble*) ens1, (Ensemble*) ens2 ) == 0;
+}
+
 
 Ensemble * creer_ensemble(
 	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
@@ -90,6 +125,25 @@ Ensemble * creer_ensemble(
 	result->comparer_element = comparer_element;
 	result->copier_element = copier_element;
 	result->supprimer_element = supprimer_element;
+	result->hachage = 0;
+	result->hachage_a_jour = 1;
+	return result;
+}
+
+Ensemble * creer_ensemble_arbre_b(
+	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
+	intptr_t (*copier_element)( const intptr_t elem ),
+	void (*supprimer_element)(intptr_t elem )
+){
+	Ensemble * result = (Ensemble*) xmalloc( sizeof(Ensemble) );
+	result->table = creer_table_arbre_b(
+		comparer_element, copier_element, supprimer_element
+	);
+	result->comparer_element = comparer_element;
+	result->copier_element = copier_element;
+	result->supprimer_element = supprimer_element;
+	result->hachage = 0;
+	result->hachage_a_jour = 1;
 	return result;
 }
 
@@ -101,7 +155,11 @@ void liberer_ensemble( Ensemble * ens ){
 }
 
 void ajouter_element( Ensemble * ensemble, const intptr_t element ){
-	add_table( ensemble->table, element, (intptr_t) NULL );
+	int nouveau;
+	trouver_ou_ajouter_table( ensemble->table, element, &nouveau );
+	if( nouveau ){
+		ensemble->hachage += hacher_element_ensemble( ensemble, element );
+	}
 }
 
 
@@ -114,7 +172,11 @@ void ajouter_elements( Ensemble * ens1, const Ensemble * ens2 ){
 }
 
 void retirer_element( Ensemble * ensemble, const intptr_t element ){
+	unsigned int taille = taille_table( ensemble->table );
 	delete_table( ensemble->table, element );
+	if( taille_table( ensemble->table ) != taille ){
+		ensemble->hachage -= hacher_element_ensemble( ensemble, element );
+	}
 }
 
 void action_retirer_elements( const intptr_t element, void* ens ){
@@ -127,21 +189,16 @@ void retirer_elements( Ensemble * ens1, const Ensemble * ens2 ){
 
 void vider_ensemble( Ensemble * ensemble ){
 	vider_table( ensemble->table );
+	ensemble->hachage = 0;
+	ensemble->hachage_a_jour = 1;
 }
 
 int est_dans_l_ensemble( const Ensemble * ensemble, intptr_t element ){
-	Table_iterateur it = trouver_table( ensemble->table, element );
-	return ! avl_t_is_null( &it ); 
-}
-
-void action_taille_ensemble( const intptr_t element, void* taille ){
-	(*(int*) taille)+=1;
+	return chercher_valeur_table( ensemble->table, element ) != NULL;
 }
 
 unsigned int taille_ensemble( const Ensemble* ensemble ){
-	int taille = 0;
-	pour_tout_element( ensemble, action_taille_ensemble, &taille );
-	return taille;
+	return taille_table( ensemble->table );
 }
 
 typedef struct {
@@ -198,51 +255,301 @@ void swap_ensemble( Ensemble* ens1, Ensemble* ens2 ){
 	void* tmp = ens1->table;
 	ens1->table = ens2->table;
 	ens2->table = tmp;
+	unsigned long hachage = ens1->hachage;
+	ens1->hachage = ens2->hachage;
+	ens2->hachage = hachage;
+	int a_jour = ens1->hachage_a_jour;
+	ens1->hachage_a_jour = ens2->hachage_a_jour;
+	ens2->hachage_a_jour = a_jour;
 }
 void deplacer_ensemble( Ensemble* ens1, Ensemble* ens2 ){
 	swap_ensemble( ens1, ens2 );
 	liberer_ensemble( ens2 );
 }
 
+Ensemble* envelopper_table( const Ensemble* modele, Table* table ){
+	Ensemble * result = (Ensemble*) xmalloc( sizeof(Ensemble) );
+	result->table = table;
+	result->comparer_element = modele->comparer_element;
+	result->copier_element = modele->copier_element;
+	result->supprimer_element = modele->supprimer_element;
+	result->hachage = 0;
+	result->hachage_a_jour = 0;
+	return result;
+}
+
+/*
+ * Renvoie Vrai si chercher un à un les 'petit' éléments d'un ensemble dans 
+ * un ensemble de 'grand' éléments coûte moins cher que de fusionner les deux 
+ * ensembles, c'est à dire si petit * log2( grand ) < petit + grand.
+ */
+int recherche_moins_couteuse_que_fusion( unsigned int petit, unsigned int grand ){
+	unsigned int log2 = 1;
+	unsigned int n;
+	for( n = grand; n > 1; n >>= 1 ) log2++;
+	return (unsigned long) petit * log2 < (unsigned long) petit + grand;
+}
+
+Ensemble* creer_ensemble_depuis_tableau_trie(
+	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
+	intptr_t (*copier_element)( const intptr_t elem ),
+	void (*supprimer_element)(intptr_t elem ),
+	const intptr_t * elements, unsigned int nb
+){
+	Ensemble * result = (Ensemble*) xmalloc( sizeof(Ensemble) );
+	result->table = creer_table_depuis_tableau_trie(
+		comparer_element, copier_element, supprimer_element,
+		elements, NULL, nb
+	);
+	result->comparer_element = comparer_element;
+	result->copier_element = copier_element;
+	result->supprimer_element = supprimer_element;
+	result->hachage = 0;
+	result->hachage_a_jour = 0;
+	return result;
+}
+
 Ensemble* copier_ensemble( const Ensemble* ensemble ){
-	Ensemble* res = creer_ensemble(
-		ensemble->comparer_element, ensemble->copier_element,
-		ensemble->supprimer_element
+	Ensemble * res = envelopper_table( 
+		ensemble, copier_table( ensemble->table, NULL ) 
 	);
-	ajouter_elements( res, ensemble  );
+	res->hachage = ensemble->hachage;
+	res->hachage_a_jour = ensemble->hachage_a_jour;
 	return res;
 }
 
 Ensemble * creer_union_ensemble( const Ensemble* ens1, const Ensemble* ens2 ){
-	Ensemble * res = copier_ensemble( ens1 );
-	ajouter_elements( res, ens2 );
-	return res;
+	return envelopper_table( ens1, creer_union_table( ens1->table, ens2->table ) );
 }
 
 Ensemble * creer_difference_ensemble(
 	const Ensemble* ens1, const Ensemble* ens2
 ){
-	Ensemble * res = copier_ensemble( ens1 );
-	retirer_elements( res, ens2 );
-	return res;
+	return envelopper_table( 
+		ens1, creer_difference_table( ens1->table, ens2->table )
+	);
 }
 
 Ensemble * creer_intersection_ensemble(
 	const Ensemble* ens1, const Ensemble* ens2
 ){
-	Ensemble *tmp, *res;
-	tmp = creer_difference_ensemble( ens1, ens2 );
-	res = creer_difference_ensemble( ens1, tmp );
-	liberer_ensemble( tmp );
+	const Ensemble * petit = ens1;
+	const Ensemble * grand = ens2;
+	if( taille_ensemble( ens2 ) < taille_ensemble( ens1 ) ){
+		petit = ens2;
+		grand = ens1;
+	}
+	if( 
+		! recherche_moins_couteuse_que_fusion( 
+			taille_ensemble( petit ), taille_ensemble( grand )
+		)
+	){
+		return envelopper_table( 
+			ens1, creer_intersection_table( ens1->table, ens2->table )
+		);
+	}
+
+	// Si un des ensembles est beaucoup plus petit que l'autre, on parcourt le
+	// plus petit et on cherche ses éléments dans le plus grand.
+	Ensemble * res = creer_ensemble(
+		ens1->comparer_element, ens1->copier_element,
+		ens1->supprimer_element
+	);
+	Ensemble_curseur it;
+	for(
+		placer_curseur_ensemble( &it, petit );
+		! curseur_ensemble_est_vide( &it );
+		avancer_curseur_ensemble( &it )
+	){
+		if( est_dans_l_ensemble( grand, element_du_curseur( &it ) ) ){
+			ajouter_element( res, element_du_curseur( &it ) );
+		}
+	}
+	return res;
+}
+
+void union_dans( Ensemble* ens1, const Ensemble* ens2 ){
+	union_dans_table( ens1->table, ens2->table );
+	ens1->hachage_a_jour = 0;
+}
+
+void intersection_dans( Ensemble* ens1, const Ensemble* ens2 ){
+	intersection_dans_table( ens1->table, ens2->table );
+	ens1->hachage_a_jour = 0;
+}
+
+unsigned long calculer_hachage_ensemble( const Ensemble* ensemble ){
+	unsigned long res = 0;
+	Ensemble_curseur it;
+	for(
+		placer_curseur_ensemble( &it, ensemble );
+		! curseur_ensemble_est_vide( &it );
+		avancer_curseur_ensemble( &it )
+	){
+		res += hacher_element_ensemble( ensemble, element_du_curseur( &it ) );
+	}
+	return res;
+}
+
+/**
+ * \par Implémentation
+ * Une valeur périmée est recalculée sans être rangée dans l'ensemble : la 
+ * fonction n'écrit rien, et plusieurs fils d'exécution peuvent donc hacher 
+ * le même ensemble en même temps. actualiser_hachage_ensemble() range la 
+ * valeur recalculée.
+ */
+unsigned long hacher_ensemble( const Ensemble* ensemble ){
+	if( ensemble->comparer_element ){
+		ERREUR( 
+			"Un ensemble muni d'une fonction de comparaison ne peut pas être "
+			"haché."
+		);
+	}
+	if( ! ensemble->hachage_a_jour ){
+		return calculer_hachage_ensemble( ensemble );
+	}
+	return ensemble->hachage;
+}
+
+void actualiser_hachage_ensemble( Ensemble* ensemble ){
+	if( ! ensemble->hachage_a_jour ){
+		ensemble->hachage = calculer_hachage_ensemble( ensemble );
+		ensemble->hachage_a_jour = 1;
+	}
+}
+
+struct _Catalogue_ensembles {
+	// Associe à chaque ensemble rangé son numéro. Les clés sont les copies 
+	// rangées dans 'ensembles'.
+	Hachage * numeros;
+	// Les ensembles rangés, par numéro.
+	Ensemble ** ensembles;
+	size_t nb;
+	size_t capacite;
+};
+
+unsigned long hacher_cle_ensemble( const intptr_t cle ){
+	return hacher_ensemble( (const Ensemble *) cle );
+}
+
+/*
+ * La table de hachage ne compare que des ensembles de même valeur de 
+ * hachage : il ne reste qu'à comparer leurs éléments.
+ */
+int comparer_cles_ensembles( const intptr_t cle1, const intptr_t cle2 ){
+	return ! ensembles_egaux( (const Ensemble *) cle1, (const Ensemble *) cle2 );
+}
+
+Catalogue_ensembles * creer_catalogue_ensembles(){
+	Catalogue_ensembles * res = xmalloc( sizeof( Catalogue_ensembles ) );
+	res->numeros = creer_hachage( hacher_cle_ensemble, comparer_cles_ensembles );
+	res->ensembles = NULL;
+	res->nb = 0;
+	res->capacite = 0;
 	return res;
 }
 
+void liberer_catalogue_ensembles( Catalogue_ensembles * catalogue ){
+	if( catalogue ){
+		size_t i;
+		for( i=0; i<catalogue->nb; i++ ){
+			liberer_ensemble( catalogue->ensembles[i] );
+		}
+		liberer_hachage( catalogue->numeros );
+		xfree( catalogue->ensembles );
+		xfree( catalogue );
+	}
+}
+
+size_t taille_catalogue_ensembles( const Catalogue_ensembles * catalogue ){
+	return catalogue->nb;
+}
+
+/**
+ * \par Implémentation
+ * La valeur de hachage de l'ensemble est rangée avant la recherche : la 
+ * table la demande en temps constant, et la copie éventuelle en hérite.
+ */
+size_t numero_ensemble( 
+	Catalogue_ensembles * catalogue, Ensemble * ensemble, int* nouveau
+){
+	actualiser_hachage_ensemble( ensemble );
+	int ajoute;
+	Hachage_case * c = inserer_hachage( 
+		catalogue->numeros, (intptr_t) ensemble, &ajoute 
+	);
+	if( nouveau ){
+		*nouveau = ajoute;
+	}
+	if( ! ajoute ){
+		return (size_t) c->valeur;
+	}
+	// La case reçoit une copie de l'ensemble : 'ensemble' reste à la charge 
+	// de l'appelant.
+	Ensemble * copie = copier_ensemble( ensemble );
+	c->cle = (intptr_t) copie;
+	c->valeur = (intptr_t) catalogue->nb;
+
+	if( catalogue->nb == catalogue->capacite ){
+		size_t capacite = 2 * catalogue->capacite + 16;
+		Ensemble ** ensembles = xmalloc( capacite * sizeof( Ensemble * ) );
+		if( catalogue->nb ){
+			memcpy( 
+				ensembles, catalogue->ensembles, 
+				catalogue->nb * sizeof( Ensemble * ) 
+			);
+		}
+		xfree( catalogue->ensembles );
+		catalogue->ensembles = ensembles;
+		catalogue->capacite = capacite;
+	}
+	catalogue->ensembles[ catalogue->nb ] = copie;
+	return catalogue->nb++;
+}
+
+int chercher_numero_ensemble( 
+	const Catalogue_ensembles * catalogue, const Ensemble * ensemble,
+	size_t * numero
+){
+	const Hachage_case * c = chercher_hachage( 
+		catalogue->numeros, (intptr_t) ensemble 
+	);
+	if( ! c ){
+		return 0;
+	}
+	if( numero ){
+		*numero = (size_t) c->valeur;
+	}
+	return 1;
+}
+
+const Ensemble * ensemble_du_numero( 
+	const Catalogue_ensembles * catalogue, size_t numero 
+){
+	if( numero >= catalogue->nb ){
+		ERREUR( "Numéro d'ensemble inconnu." );
+	}
+	return catalogue->ensembles[ numero ];
+}
+
 Ensemble_iterateur trouver_ensemble(
 	const Ensemble* ensemble, const intptr_t element
 ){
 	return trouver_table( ensemble->table, element );
 }
 
+Ensemble_iterateur premier_iterateur_superieur_ou_egal_ensemble(
+	const Ensemble* ensemble, const intptr_t element
+){
+	return premier_iterateur_superieur_ou_egal_table( ensemble->table, element );
+}
+
+Ensemble_iterateur premier_iterateur_superieur_ensemble(
+	const Ensemble* ensemble, const intptr_t element
+){
+	return premier_iterateur_superieur_table( ensemble->table, element );
+}
+
 Ensemble_iterateur premier_iterateur_ensemble( const Ensemble* ensemble ){
 	return premier_iterateur_table( ensemble->table );
 }
@@ -264,3 +571,21 @@ int iterateur_ensemble_est_vide( Ensemble_iterateur iterateur ){
 const intptr_t get_element( Ensemble_iterateur it ){
 	return get_cle( it );
 }
+
+void placer_curseur_ensemble( 
+	Ensemble_curseur * curseur, const Ensemble* ensemble 
+){
+	placer_curseur_table( curseur, ensemble->table );
+}
+
+void avancer_curseur_ensemble( Ensemble_curseur * curseur ){
+	avancer_curseur_table( curseur );
+}
+
+int curseur_ensemble_est_vide( const Ensemble_curseur * curseur ){
+	return curseur_table_est_vide( curseur );
+}
+
+intptr_t element_du_curseur( const Ensemble_curseur * curseur ){
+	return cle_du_curseur_table( curseur );
+}
@@ -22,9 +22,10 @@
 #ifndef __ENSEMBLE_H__
 #define __ENSEMBLE_H__
 
+#include <stddef.h>
 #include <stdint.h>
 
-#include "avl.h"
+#include "table.h"
 
 
 /*
@@ -35,7 +36,24 @@ typedef struct _Ensemble Ensemble;
 /*
  * Définit le type d'un itérateur sur les éléments d'un ensemble.
  */
-typedef struct avl_traverser Ensemble_iterateur;
+typedef Table_iterateur Ensemble_iterateur;
+
+/*
+ * Définit le type d'un curseur sur les éléments d'un ensemble.
+ *
+ * Comme pour les tables (voir Table_curseur), un curseur est modifié sur 
+ * place, sans recopie :
+ *
+ * Ensemble_curseur c;
+ * for(
+ *     placer_curseur_ensemble( &c, ens );
+ *     ! curseur_ensemble_est_vide( &c );
+ *     avancer_curseur_ensemble( &c )
+ * ){
+ *     printf( "%ld\n", element_du_curseur( &c ) );
+ * }
+ */
+typedef Table_curseur Ensemble_curseur;
 
 /*
  * Renvoie un nouvel ensemble vide.
@@ -57,6 +75,36 @@ Ensemble * creer_ensemble(
 	void (*supprimer_element)( intptr_t elem )
 );
 
+/*
+ * Renvoie un nouvel ensemble vide, codé par un arbre B+ (voir 
+ * creer_table_arbre_b()) : c'est le codage à préférer pour les grands 
+ * ensembles. Les paramètres ont le même rôle que pour creer_ensemble().
+ *
+ * Un curseur sur un tel ensemble n'est plus valide dès que l'ensemble est
+ * modifié.
+ */
+Ensemble * creer_ensemble_arbre_b(
+	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
+	intptr_t (*copier_element)( const intptr_t elem ),
+	void (*supprimer_element)( intptr_t elem )
+);
+
+/*
+ * Renvoie un nouvel ensemble contenant les 'nb' éléments du tableau 
+ * 'elements'.
+ *
+ * Les éléments doivent être triés par ordre strictement croissant (pour la 
+ * fonction 'comparer_element'). L'ensemble est alors construit en temps 
+ * linéaire, sans aucun rééquilibrage.
+ * Les éléments sont copiés comme dans ajouter_element().
+ */
+Ensemble * creer_ensemble_depuis_tableau_trie(
+	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
+	intptr_t (*copier_element)( const intptr_t elem ),
+	void (*supprimer_element)( intptr_t elem ),
+	const intptr_t * elements, unsigned int nb
+);
+
 /*
  * Libère la mémoire d'un ensemble.
  * La mémoire de tous les éléments de l'ensemble est aussi libérée.
@@ -106,6 +154,8 @@ int est_dans_l_ensemble( const Ensemble * ensemble, const intptr_t element );
 
 /*
  * Renvoie le nombre d'éléments qui se trouvent dans l'ensemble.
+ *
+ * Le calcul se fait en temps constant.
  */
 unsigned int taille_ensemble( const Ensemble* ensemble );
 
@@ -122,13 +172,120 @@ unsigned int taille_ensemble( const Ensemble* ensemble );
 int comparer_ensemble( Ensemble* ens1, Ensemble*  ens2 );
 
 /*
- * Renvoie une copie de l'ensemble passé en paramètre
+ * Renvoie Vrai si les deux ensembles contiennent exactement les mêmes 
+ * éléments.
+ *
+ * Contrairement à comparer_ensemble(), la fonction s'arrête immédiatement si 
+ * les deux ensembles n'ont pas la même taille.
+ */
+int ensembles_egaux( const Ensemble* ens1, const Ensemble* ens2 );
+
+/*
+ * Renvoie une valeur de hachage du contenu de l'ensemble : deux ensembles
+ * égaux ont la même valeur de hachage.
+ *
+ * La valeur est la somme des valeurs de hachage des éléments, mise à jour à
+ * chaque ajout ou retrait d'élément : elle est alors obtenue en temps
+ * constant. Après une opération qui modifie l'ensemble en bloc (union_dans(),
+ * intersection_dans(), etc.), elle est recalculée en temps linéaire au
+ * premier appel.
+ *
+ * La valeur recalculée n'est pas conservée (la fonction ne modifie pas 
+ * l'ensemble, et peut être appelée par plusieurs fils d'exécution sur le même
+ * ensemble) : actualiser_hachage_ensemble() la conserve.
+ *
+ * Les éléments sont hachés par leur valeur. Si l'ensemble a une fonction de
+ * comparaison, deux éléments égaux peuvent avoir des valeurs différentes : 
+ * un tel ensemble ne peut pas être haché, et la fonction termine le 
+ * programme par une erreur.
+ */
+unsigned long hacher_ensemble( const Ensemble* ensemble );
+
+/*
+ * Recalcule, si elle n'est plus à jour, la valeur de hachage de l'ensemble 
+ * et la conserve : les appels suivants à hacher_ensemble() s'exécutent alors
+ * en temps constant.
+ */
+void actualiser_hachage_ensemble( Ensemble* ensemble );
+
+/*
+ * Catalogue d'ensembles : chaque ensemble distinct n'y est rangé qu'une
+ * fois, et reçoit un numéro (0, 1, 2, ... dans l'ordre des ajouts) qui ne
+ * change plus.
+ *
+ * Deux ensembles rangés sont égaux si et seulement si ils ont le même
+ * numéro : les ensembles numérotés se comparent en temps constant. Une
+ * recherche dans le catalogue hache l'ensemble (voir hacher_ensemble()) et
+ * ne le compare, en moyenne, qu'aux ensembles qui lui sont égaux.
+ *
+ * Comme pour hacher_ensemble(), les ensembles munis d'une fonction de 
+ * comparaison ne peuvent pas être rangés dans un catalogue.
+ */
+typedef struct _Catalogue_ensembles Catalogue_ensembles;
+
+/*
+ * Crée un catalogue vide.
+ */
+Catalogue_ensembles * creer_catalogue_ensembles();
+
+/*
+ * Libère le catalogue et les ensembles qui y sont rangés.
+ */
+void liberer_catalogue_ensembles( Catalogue_ensembles * catalogue );
+
+/*
+ * Renvoie le nombre d'ensembles rangés dans le catalogue.
+ */
+size_t taille_catalogue_ensembles( const Catalogue_ensembles * catalogue );
+
+/*
+ * Renvoie le numéro de l'ensemble dans le catalogue. Si aucun ensemble égal
+ * n'y est rangé, une copie de l'ensemble est ajoutée au catalogue et reçoit
+ * un nouveau numéro.
+ * Si 'nouveau' n'est pas NULL, *nouveau vaut ensuite 1 si l'ensemble a été
+ * ajouté et 0 sinon.
+ *
+ * L'ensemble passé en paramètre reste à la charge de l'appelant. Sa valeur
+ * de hachage est d'abord mise à jour (voir actualiser_hachage_ensemble()) :
+ * c'est sa seule modification.
+ */
+size_t numero_ensemble(
+	Catalogue_ensembles * catalogue, Ensemble * ensemble, int* nouveau
+);
+
+/*
+ * Renvoie 1 si un ensemble égal à celui passé en paramètre est rangé dans le
+ * catalogue, et range alors son numéro dans '*numero' (si 'numero' n'est pas
+ * NULL). Renvoie 0 sinon.
+ */
+int chercher_numero_ensemble(
+	const Catalogue_ensembles * catalogue, const Ensemble * ensemble,
+	size_t * numero
+);
+
+/*
+ * Renvoie l'ensemble du catalogue qui porte le numéro passé en paramètre.
+ * L'ensemble appartient au catalogue et ne doit pas être modifié.
+ */
+const Ensemble * ensemble_du_numero(
+	const Catalogue_ensembles * catalogue, size_t numero
+);
+
+/*
+ * Renvoie une copie de l'ensemble passé en paramètre.
+ *
+ * La copie est construite en temps linéaire.
  */
 Ensemble* copier_ensemble( const Ensemble* ensemble );
 
 /*
- * Crée un nouvel ensemble qui est la copie de deux ensembles passés en 
- * paramètre
+ * Crée un nouvel ensemble qui est l'union de deux ensembles passés en 
+ * paramètre.
+ *
+ * Comme pour creer_difference_ensemble() et creer_intersection_ensemble(),
+ * les deux ensembles sont fusionnés en un seul parcours ordonné, et le
+ * résultat est construit directement sous la forme d'un arbre équilibré.
+ * Le coût est linéaire en la somme des tailles des deux ensembles.
  */
 Ensemble * creer_union_ensemble( const Ensemble* ens1, const Ensemble* ens2 );
 
@@ -143,11 +300,30 @@ Ensemble * creer_difference_ensemble(
 /*
  * Créé un nouvel ensemble qui est l'intersection de deux ensembles passés en 
  * paramètre.
+ *
+ * Si l'un des ensembles est beaucoup plus petit que l'autre, ses éléments 
+ * sont simplement recherchés dans le plus grand.
  */
 Ensemble * creer_intersection_ensemble(
 	const Ensemble* ens1, const Ensemble* ens2
 );
 
+/*
+ * Ajoute à ens1 tous les éléments de ens2, en fusionnant les deux ensembles
+ * en temps linéaire. Les éléments déjà présents dans ens1 ne sont pas
+ * recopiés.
+ *
+ * Pour ajouter quelques éléments à un grand ensemble, ajouter_elements() 
+ * reste préférable.
+ */
+void union_dans( Ensemble* ens1, const Ensemble* ens2 );
+
+/*
+ * Retire de ens1 tous les éléments qui n'appartiennent pas à ens2, en 
+ * fusionnant les deux ensembles en temps linéaire.
+ */
+void intersection_dans( Ensemble* ens1, const Ensemble* ens2 );
+
 /*
  * Passe en revue tous les éléments d'un ensemble et execute un fonction 
  * passée en paramètre.
@@ -186,6 +362,21 @@ Ensemble_iterateur trouver_ensemble(
 	const Ensemble* ensemble, const intptr_t element
 );
 
+/*
+ * Renvoie un itérateur positionné sur le plus petit élément de l'ensemble 
+ * supérieur ou égal (resp. strictement supérieur) à l'élément passé en 
+ * paramètre, ou l'itérateur vide si un tel élément n'existe pas.
+ *
+ * L'élément n'a pas besoin d'appartenir à l'ensemble : voir 
+ * premier_iterateur_superieur_ou_egal_table() pour parcourir un intervalle.
+ */
+Ensemble_iterateur premier_iterateur_superieur_ou_egal_ensemble(
+	const Ensemble* ensemble, const intptr_t element
+);
+Ensemble_iterateur premier_iterateur_superieur_ensemble(
+	const Ensemble* ensemble, const intptr_t element
+);
+
 /*
  * Renvoie un itérateur positionné sur le premier élement de l'ensemble.
  */
@@ -232,4 +423,27 @@ int iterateur_ensemble_est_vide( Ensemble_iterateur iterateur );
  */
 const intptr_t get_element( Ensemble_iterateur it );
 
+/*
+ * Place le curseur sur le plus petit élément de l'ensemble.
+ */
+void placer_curseur_ensemble( 
+	Ensemble_curseur * curseur, const Ensemble* ensemble 
+);
+
+/*
+ * Déplace le curseur sur l'élément suivant.
+ * Après le plus grand élément, le curseur devient vide.
+ */
+void avancer_curseur_ensemble( Ensemble_curseur * curseur );
+
+/*
+ * Renvoie 1 si le curseur est vide, 0 sinon.
+ */
+int curseur_ensemble_est_vide( const Ensemble_curseur * curseur );
+
+/*
+ * Renvoie l'élément sur lequel est placé le curseur.
+ */
+intptr_t element_du_curseur( const Ensemble_curseur * curseur );
+
 #endif
@@ -23,6 +23,7 @@
 #include "outils.h"
 #include "fifo.h"
 
+#include <pthread.h>
 #include <signal.h>
 #include <errno.h>
 
@@ -522,6 +523,911 @@ int test_automate_vide(){
 
 }
 
+typedef struct {
+	int nb;
+	char lettres[8];
+	int fins[8];
+} Transitions_vues;
+
+void noter_transition( int origine, char lettre, int fin, void* data ){
+	Transitions_vues * vues = (Transitions_vues *) data;
+	if( vues->nb < 8 ){
+		vues->lettres[vues->nb] = lettre;
+		vues->fins[vues->nb] = fin;
+	}
+	vues->nb++;
+}
+
+int test_transitions_depuis(){
+	BEGIN_TEST;
+
+	int result = 1;
+
+	Automate * automate = creer_automate();
+
+	ajouter_transition( automate, 1, 'c', 3 );
+	ajouter_transition( automate, 1, 'a', 2 );
+	ajouter_transition( automate, 2, 'a', 1 );
+	ajouter_transition( automate, 1, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 1 );
+
+	Transitions_vues vues;
+	vues.nb = 0;
+	pour_toute_transition_depuis( automate, 1, noter_transition, &vues );
+
+	TEST( 
+		1
+		&& vues.nb == 4
+		&& vues.lettres[0] == 'a' && vues.fins[0] == 1
+		&& vues.lettres[1] == 'a' && vues.fins[1] == 2
+		&& vues.lettres[2] == 'b' && vues.fins[2] == 1
+		&& vues.lettres[3] == 'c' && vues.fins[3] == 3
+		, result
+	);
+
+	vues.nb = 0;
+	pour_toute_transition_depuis( automate, 3, noter_transition, &vues );
+	TEST( vues.nb == 0, result );
+
+	Automate * copie = copier_automate( automate );
+	liberer_automate( automate );
+
+	TEST( 
+		1
+		&& est_une_transition_de_l_automate( copie, 1, 'c', 3 )
+		&& est_une_transition_de_l_automate( copie, 2, 'a', 1 )
+		&& ! est_une_transition_de_l_automate( copie, 2, 'b', 1 )
+		&& est_une_transition_de_l_automate( copie, 1, 'a', 2 )
+		, result
+	);
+
+	liberer_automate( copie );
+
+	return result;
+}
+
+int test_etats_accessibles(){
+	BEGIN_TEST;
+
+	int result = 1;
+
+	Automate * automate = creer_automate();
+
+	ajouter_transition( automate, -2, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 5 );
+	ajouter_transition( automate, 5, 'a', 0 );
+	ajouter_transition( automate, 5, 'b', 7 );
+	ajouter_transition( automate, 3, 'a', -2 );
+	ajouter_etat( automate, 100 );
+
+	Ensemble * accessibles = etats_accessibles( automate, -2 );
+	Ensemble * attendus = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( attendus, 0 );
+	ajouter_element( attendus, 5 );
+	ajouter_element( attendus, 7 );
+	TEST( ensembles_egaux( accessibles, attendus ), result );
+	liberer_ensemble( accessibles );
+
+	// L'état de départ n'est accessible que par le cycle 0 -> 5 -> 0.
+	accessibles = etats_accessibles( automate, 0 );
+	TEST( ensembles_egaux( accessibles, attendus ), result );
+	liberer_ensemble( accessibles );
+
+	accessibles = etats_accessibles( automate, 7 );
+	TEST( taille_ensemble( accessibles ) == 0, result );
+	liberer_ensemble( accessibles );
+
+	accessibles = etats_accessibles( automate, 42 );
+	TEST( taille_ensemble( accessibles ) == 0, result );
+	liberer_ensemble( accessibles );
+
+	Ensemble * departs = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( departs, 3 );
+	ajouter_element( departs, 7 );
+	ajouter_element( departs, 100 );
+	accessibles = etats_accessibles_depuis( automate, departs );
+	ajouter_element( attendus, -2 );
+	TEST( ensembles_egaux( accessibles, attendus ), result );
+	liberer_ensemble( accessibles );
+	liberer_ensemble( departs );
+
+	liberer_ensemble( attendus );
+	liberer_automate( automate );
+
+	// Des états très éloignés : la mémoire du parcours ne dépend que du 
+	// nombre d'états.
+	automate = creer_automate();
+	ajouter_transition( automate, -2000000000, 'a', 2000000000 );
+	ajouter_etat_initial( automate, -2000000000 );
+	ajouter_etat_final( automate, 2000000000 );
+
+	accessibles = etats_accessibles( automate, -2000000000 );
+	TEST( 
+		taille_ensemble( accessibles ) == 1 
+		&& est_dans_l_ensemble( accessibles, 2000000000 )
+		, result 
+	);
+	liberer_ensemble( accessibles );
+
+	attendus = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( attendus, 2000000000 );
+	accessibles = etats_co_accessibles( automate, attendus );
+	TEST( 
+		taille_ensemble( accessibles ) == 1 
+		&& est_dans_l_ensemble( accessibles, -2000000000 )
+		, result 
+	);
+	liberer_ensemble( accessibles );
+	liberer_ensemble( attendus );
+
+	Automate * prefixes = creer_automate_des_prefixes( automate );
+	TEST( 
+		1
+		&& le_mot_est_reconnu( prefixes, "" )
+		&& le_mot_est_reconnu( prefixes, "a" )
+		&& ! le_mot_est_reconnu( prefixes, "aa" )
+		, result 
+	);
+	liberer_automate( prefixes );
+	liberer_automate( automate );
+
+	return result;
+}
+
+int test_etats_co_accessibles(){
+	BEGIN_TEST;
+
+	int result = 1;
+
+	Automate * automate = creer_automate();
+
+	ajouter_transition( automate, -2, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 5 );
+	ajouter_transition( automate, 5, 'a', 0 );
+	ajouter_transition( automate, 5, 'b', 7 );
+	ajouter_transition( automate, 3, 'a', -2 );
+
+	Ensemble * arrivees = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( arrivees, 7 );
+	Ensemble * co_accessibles = etats_co_accessibles( automate, arrivees );
+	Ensemble * attendus = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( attendus, -2 );
+	ajouter_element( attendus, 0 );
+	ajouter_element( attendus, 3 );
+	ajouter_element( attendus, 5 );
+	TEST( ensembles_egaux( co_accessibles, attendus ), result );
+	liberer_ensemble( co_accessibles );
+
+	vider_ensemble( arrivees );
+	ajouter_element( arrivees, 3 );
+	co_accessibles = etats_co_accessibles( automate, arrivees );
+	TEST( taille_ensemble( co_accessibles ) == 0, result );
+	liberer_ensemble( co_accessibles );
+
+	liberer_ensemble( attendus );
+	liberer_ensemble( arrivees );
+	liberer_automate( automate );
+
+	automate = creer_automate();
+	ajouter_transition( automate, 1, 'a', 2 );
+	ajouter_transition( automate, 2, 'b', 3 );
+	ajouter_etat_initial( automate, 1 );
+	ajouter_etat_final( automate, 3 );
+	Automate * prefixes = creer_automate_des_prefixes( automate );
+	Automate * suffixes = creer_automate_des_suffixes( automate );
+	Automate * facteurs = creer_automate_des_facteurs( automate );
+
+	TEST( 
+		1
+		&& le_mot_est_reconnu( prefixes, "a" )
+		&& le_mot_est_reconnu( prefixes, "ab" )
+		&& ! le_mot_est_reconnu( prefixes, "b" )
+		&& le_mot_est_reconnu( suffixes, "b" )
+		&& le_mot_est_reconnu( suffixes, "ab" )
+		&& ! le_mot_est_reconnu( suffixes, "a" )
+		&& le_mot_est_reconnu( facteurs, "a" )
+		&& le_mot_est_reconnu( facteurs, "b" )
+		&& ! le_mot_est_reconnu( facteurs, "ba" )
+		, result
+	);
+
+	liberer_automate( prefixes );
+	liberer_automate( suffixes );
+	liberer_automate( facteurs );
+	liberer_automate( automate );
+
+	return result;
+}
+
+int test_automate_emonde(){
+	BEGIN_TEST;
+
+	int result = 1;
+
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 1, 'a', 2 );
+	ajouter_transition( automate, 2, 'b', 3 );
+	ajouter_transition( automate, 2, 'a', 4 );
+	ajouter_transition( automate, 5, 'a', 3 );
+	ajouter_etat( automate, 6 );
+	ajouter_etat_initial( automate, 1 );
+	ajouter_etat_initial( automate, 7 );
+	ajouter_etat_final( automate, 3 );
+
+	Automate * accessible = automate_accessible( automate );
+	TEST( 
+		1
+		&& taille_ensemble( get_etats( accessible ) ) == 5
+		&& est_un_etat_de_l_automate( accessible, 4 )
+		&& est_un_etat_initial_de_l_automate( accessible, 7 )
+		&& ! est_un_etat_de_l_automate( accessible, 5 )
+		&& ! est_un_etat_de_l_automate( accessible, 6 )
+		&& est_une_transition_de_l_automate( accessible, 2, 'a', 4 )
+		&& ! est_une_transition_de_l_automate( accessible, 5, 'a', 3 )
+		&& le_mot_est_reconnu( accessible, "ab" )
+		, result
+	);
+
+	Automate * co_accessible = automate_co_accessible( automate );
+	TEST( 
+		1
+		&& taille_ensemble( get_etats( co_accessible ) ) == 4
+		&& est_un_etat_de_l_automate( co_accessible, 5 )
+		&& ! est_un_etat_de_l_automate( co_accessible, 4 )
+		&& ! est_un_etat_initial_de_l_automate( co_accessible, 7 )
+		&& est_une_transition_de_l_automate( co_accessible, 5, 'a', 3 )
+		&& le_mot_est_reconnu( co_accessible, "ab" )
+		, result
+	);
+
+	Automate * emonde = automate_emonde( automate );
+	TEST( 
+		1
+		&& taille_ensemble( get_etats( emonde ) ) == 3
+		&& taille_ensemble( get_initiaux( emonde ) ) == 1
+		&& est_un_etat_initial_de_l_automate( emonde, 1 )
+		&& est_un_etat_final_de_l_automate( emonde, 3 )
+		&& est_une_lettre_de_l_automate( emonde, 'a' )
+		&& est_une_transition_de_l_automate( emonde, 1, 'a', 2 )
+		&& est_une_transition_de_l_automate( emonde, 2, 'b', 3 )
+		&& ! est_une_transition_de_l_automate( emonde, 2, 'a', 4 )
+		&& le_mot_est_reconnu( emonde, "ab" )
+		&& ! le_mot_est_reconnu( emonde, "aa" )
+		, result
+	);
+
+	liberer_automate( accessible );
+	liberer_automate( co_accessible );
+	liberer_automate( emonde );
+	liberer_automate( automate );
+
+	return result;
+}
+
+int test_index_des_predecesseurs(){
+	BEGIN_TEST;
+
+	int result = 1;
+
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 1, 'b', 3 );
+	ajouter_transition( automate, 2, 'a', 3 );
+
+	// Sans index, toutes les transitions sont examinées.
+	Transitions_vues vues;
+	vues.nb = 0;
+	pour_toute_transition_vers( automate, 3, noter_transition, &vues );
+	TEST( vues.nb == 2, result );
+
+	indexer_predecesseurs( automate );
+	ajouter_transition( automate, 3, 'a', 3 );
+	ajouter_transition( automate, 4, 'a', 1 );
+
+	vues.nb = 0;
+	pour_toute_transition_vers( automate, 3, noter_transition, &vues );
+	TEST( 
+		1
+		&& vues.nb == 3
+		&& vues.lettres[0] == 'a' && vues.fins[0] == 3
+		&& vues.lettres[1] == 'a' && vues.fins[1] == 3
+		&& vues.lettres[2] == 'b' && vues.fins[2] == 3
+		, result
+	);
+
+	vues.nb = 0;
+	pour_toute_transition_vers( automate, 4, noter_transition, &vues );
+	TEST( vues.nb == 0, result );
+
+	Automate * copie = copier_automate( automate );
+	ajouter_transition( copie, 5, 'c', 4 );
+
+	Ensemble * arrivees = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( arrivees, 1 );
+	Ensemble * co_accessibles = etats_co_accessibles( copie, arrivees );
+	Ensemble * attendus = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( attendus, 4 );
+	ajouter_element( attendus, 5 );
+	TEST( ensembles_egaux( co_accessibles, attendus ), result );
+	liberer_ensemble( co_accessibles );
+
+	co_accessibles = etats_co_accessibles( automate, arrivees );
+	retirer_element( attendus, 5 );
+	TEST( ensembles_egaux( co_accessibles, attendus ), result );
+	liberer_ensemble( co_accessibles );
+
+	liberer_ensemble( attendus );
+	liberer_ensemble( arrivees );
+	liberer_automate( copie );
+	liberer_automate( automate );
+
+	return result;
+}
+
+int test_automate_des_sous_mots(){
+	BEGIN_TEST;
+
+	int result = 1;
+
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 1, 'a', 2 );
+	ajouter_transition( automate, 2, 'b', 3 );
+	ajouter_transition( automate, 3, 'c', 2 );
+	ajouter_transition( automate, 4, 'a', 1 );
+	ajouter_etat( automate, 5 );
+	ajouter_etat_initial( automate, 1 );
+	ajouter_etat_final( automate, 3 );
+
+	Automate * sous_mots = creer_automate_des_sous_mots( automate );
+
+	TEST( 
+		1
+		&& est_une_epsilon_transition_de_l_automate( sous_mots, 1, 2 )
+		&& est_une_epsilon_transition_de_l_automate( sous_mots, 1, 3 )
+		&& ! est_une_epsilon_transition_de_l_automate( sous_mots, 1, 1 )
+		&& est_une_epsilon_transition_de_l_automate( sous_mots, 2, 2 )
+		&& est_une_epsilon_transition_de_l_automate( sous_mots, 3, 2 )
+		&& est_une_epsilon_transition_de_l_automate( sous_mots, 4, 1 )
+		&& est_une_epsilon_transition_de_l_automate( sous_mots, 4, 3 )
+		&& ! est_une_epsilon_transition_de_l_automate( sous_mots, 5, 5 )
+		&& est_une_transition_de_l_automate( sous_mots, 3, 'c', 2 )
+		&& ! est_une_lettre_de_l_automate( sous_mots, '#' )
+		&& le_mot_est_reconnu( sous_mots, "" )
+		&& le_mot_est_reconnu( sous_mots, "bb" )
+		&& le_mot_est_reconnu( sous_mots, "ac" )
+		&& ! le_mot_est_reconnu( sous_mots, "ca" )
+		&& taille_ensemble( get_initiaux( sous_mots ) ) == 4
+		&& taille_ensemble( get_finaux( sous_mots ) ) == 4
+		&& ! est_un_etat_final_de_l_automate( sous_mots, 5 )
+		, result
+	);
+
+	liberer_automate( sous_mots );
+	liberer_automate( automate );
+
+	return result;
+}
+
+int test_epsilon_transitions(){
+	BEGIN_TEST;
+
+	int result = 1;
+
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 1, '#', 2 );
+	ajouter_epsilon_transition( automate, 2, 3 );
+	ajouter_transition( automate, 3, 'a', 4 );
+	ajouter_etat_initial( automate, 1 );
+	ajouter_etat_final( automate, 4 );
+
+	TEST( 
+		1
+		&& est_une_lettre_de_l_automate( automate, '#' )
+		&& taille_ensemble( get_alphabet( automate ) ) == 2
+		&& a_des_epsilon_transitions( automate )
+		&& est_une_epsilon_transition_de_l_automate( automate, 2, 3 )
+		&& ! est_une_epsilon_transition_de_l_automate( automate, 1, 2 )
+		&& ! est_une_transition_de_l_automate( automate, 2, '#', 3 )
+		&& le_mot_est_reconnu( automate, "#a" )
+		&& ! le_mot_est_reconnu( automate, "a" )
+		, result
+	);
+
+	const Ensemble * cloture = epsilon_cloture( automate, 2 );
+	TEST( 
+		1
+		&& taille_ensemble( cloture ) == 2
+		&& est_dans_l_ensemble( cloture, 2 )
+		&& est_dans_l_ensemble( cloture, 3 )
+		&& epsilon_cloture( automate, 2 ) == cloture
+		, result
+	);
+
+	// L'ajout d'une epsilon transition invalide les clôtures calculées.
+	ajouter_epsilon_transition( automate, 3, 5 );
+	cloture = epsilon_cloture( automate, 2 );
+	TEST( 
+		taille_ensemble( cloture ) == 3 && est_dans_l_ensemble( cloture, 5 ),
+		result
+	);
+
+	// Plusieurs ajouts de suite ne vident les clôtures qu'une fois, au 
+	// calcul suivant.
+	ajouter_epsilon_transition( automate, 5, 6 );
+	ajouter_epsilon_transition( automate, 6, 7 );
+	cloture = epsilon_cloture( automate, 2 );
+	TEST( 
+		taille_ensemble( cloture ) == 5 && est_dans_l_ensemble( cloture, 7 ),
+		result
+	);
+	TEST( taille_ensemble( epsilon_cloture( automate, 7 ) ) == 1, result );
+
+	Automate * copie = copier_automate( automate );
+	Automate * inverse = miroir( automate );
+	liberer_automate( automate );
+	TEST( 
+		1
+		&& est_une_epsilon_transition_de_l_automate( copie, 3, 5 )
+		&& taille_ensemble( epsilon_cloture( copie, 2 ) ) == 5
+		&& est_une_epsilon_transition_de_l_automate( inverse, 3, 2 )
+		&& le_mot_est_reconnu( inverse, "a#" )
+		, result
+	);
+
+	liberer_automate( inverse );
+	liberer_automate( copie );
+
+	return result;
+}
+
+int test_automate_sans_epsilon(){
+	BEGIN_TEST;
+
+	int result = 1;
+
+	// 1 et 2 forment un cycle d'epsilon transitions, qui mène à 3 puis à 4.
+	Automate * automate = creer_automate();
+	ajouter_epsilon_transition( automate, 1, 2 );
+	ajouter_epsilon_transition( automate, 2, 1 );
+	ajouter_epsilon_transition( automate, 2, 3 );
+	ajouter_epsilon_transition( automate, 5, 4 );
+	ajouter_transition( automate, 1, 'a', 1 );
+	ajouter_transition( automate, 3, 'b', 5 );
+	ajouter_transition( automate, 3, 'c', 6 );
+	ajouter_etat_initial( automate, 1 );
+	ajouter_etat_final( automate, 4 );
+
+	Automate * sans_epsilon = creer_automate_sans_epsilon( automate );
+
+	TEST( 
+		1
+		&& ! a_des_epsilon_transitions( sans_epsilon )
+		&& est_une_transition_de_l_automate( sans_epsilon, 1, 'b', 5 )
+		&& est_une_transition_de_l_automate( sans_epsilon, 1, 'a', 1 )
+		&& est_un_etat_final_de_l_automate( sans_epsilon, 5 )
+		&& ! est_un_etat_de_l_automate( sans_epsilon, 2 )
+		&& ! est_un_etat_de_l_automate( sans_epsilon, 4 )
+		&& le_mot_est_reconnu( sans_epsilon, "b" )
+		&& le_mot_est_reconnu( sans_epsilon, "aab" )
+		&& ! le_mot_est_reconnu( sans_epsilon, "" )
+		&& ! le_mot_est_reconnu( sans_epsilon, "ac" )
+		&& ! le_mot_est_reconnu( sans_epsilon, "ba" )
+		, result
+	);
+
+	liberer_automate( sans_epsilon );
+	liberer_automate( automate );
+
+	automate = creer_automate();
+	ajouter_transition( automate, 1, 'a', 2 );
+	ajouter_transition( automate, 2, 'b', 3 );
+	ajouter_transition( automate, 3, 'c', 2 );
+	ajouter_etat_initial( automate, 1 );
+	ajouter_etat_final( automate, 3 );
+	Automate * sous_mots = creer_automate_des_sous_mots( automate );
+	sans_epsilon = creer_automate_sans_epsilon( sous_mots );
+
+	const char * mots[] = { "", "a", "b", "c", "ab", "ba", "cb", "bcb", "ca", "abcbc" };
+	int i;
+	int identiques = 1;
+	for( i=0; i<10; i++ ){
+		if( 
+			le_mot_est_reconnu( sous_mots, mots[i] ) 
+			!= le_mot_est_reconnu( sans_epsilon, mots[i] ) 
+		){
+			identiques = 0;
+		}
+	}
+	TEST( identiques && ! a_des_epsilon_transitions( sans_epsilon ), result );
+
+	liberer_automate( sans_epsilon );
+	liberer_automate( sous_mots );
+	liberer_automate( automate );
+
+	return result;
+}
+
+typedef struct {
+	const Automate * autre;
+	int nb;
+	int absentes;
+} Comparaison_transitions;
+
+void chercher_transition( int origine, char lettre, int fin, void* data ){
+	Comparaison_transitions * comparaison = (Comparaison_transitions *) data;
+	comparaison->nb++;
+	if( 
+		! est_une_transition_de_l_automate( comparaison->autre, origine, lettre, fin ) 
+	){
+		comparaison->absentes++;
+	}
+}
+
+/*
+ * Renvoie 1 si les deux automates ont les mêmes transitions, les mêmes 
+ * états initiaux et les mêmes états finaux, 0 sinon.
+ */
+int memes_automates( const Automate * automate1, const Automate * automate2 ){
+	Comparaison_transitions c1 = { automate2, 0, 0 };
+	Comparaison_transitions c2 = { automate1, 0, 0 };
+	pour_toute_transition( automate1, chercher_transition, &c1 );
+	pour_toute_transition( automate2, chercher_transition, &c2 );
+	return 1
+		&& c1.nb == c2.nb && c1.absentes == 0 && c2.absentes == 0
+		&& ensembles_egaux( get_initiaux( automate1 ), get_initiaux( automate2 ) )
+		&& ensembles_egaux( get_finaux( automate1 ), get_finaux( automate2 ) );
+}
+
+typedef struct {
+	int origine;
+	char lettre;
+	int deterministe;
+} Lettres_vues;
+
+/*
+ * Les transitions sont parcourues par origine puis par lettre : deux 
+ * transitions de même lettre depuis un même état sont consécutives.
+ */
+void verifier_lettre( int origine, char lettre, int fin, void* data ){
+	Lettres_vues * vues = (Lettres_vues *) data;
+	if( vues->origine == origine && vues->lettre == lettre ){
+		vues->deterministe = 0;
+	}
+	vues->origine = origine;
+	vues->lettre = lettre;
+}
+
+/*
+ * Renvoie 1 si l'automate a au plus un état initial et si chaque état a au
+ * plus un successeur par lettre.
+ */
+int est_deterministe( const Automate * automate ){
+	Lettres_vues vues = { 0, '\0', 1 };
+	Ensemble_curseur it;
+	for(
+		placer_curseur_ensemble( &it, get_etats( automate ) );
+		! curseur_ensemble_est_vide( &it );
+		avancer_curseur_ensemble( &it )
+	){
+		vues.lettre = '\0';
+		pour_toute_transition_depuis( 
+			automate, element_du_curseur( &it ), verifier_lettre, &vues 
+		);
+	}
+	return vues.deterministe && taille_ensemble( get_initiaux( automate ) ) <= 1;
+}
+
+int test_automate_deterministe(){
+	BEGIN_TEST;
+
+	int result = 1;
+
+	// Mots dont la 5e lettre en partant de la fin est un 'a' : l'automate 
+	// déterministe a 2^5 états.
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	int i;
+	for( i=1; i<5; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 5 );
+
+	Automate * deterministe = creer_automate_deterministe( automate );
+	Automate * parallele = creer_automate_deterministe_parallele( automate, 4 );
+
+	TEST( 
+		1
+		&& est_deterministe( deterministe )
+		&& taille_ensemble( get_etats( deterministe ) ) == 32
+		&& est_un_etat_initial_de_l_automate( deterministe, 0 )
+		&& memes_automates( deterministe, parallele )
+		, result
+	);
+
+	// Tous les mots de longueur au plus 7.
+	char mot[8];
+	int longueur, code, identiques = 1;
+	for( longueur=0; longueur<=7; longueur++ ){
+		for( code=0; code < (1<<longueur); code++ ){
+			for( i=0; i<longueur; i++ ){
+				mot[i] = ( code >> i ) & 1 ? 'b' : 'a';
+			}
+			mot[longueur] = '\0';
+			if( 
+				le_mot_est_reconnu( automate, mot ) 
+				!= le_mot_est_reconnu( deterministe, mot ) 
+			){
+				identiques = 0;
+			}
+		}
+	}
+	TEST( identiques, result );
+
+	liberer_automate( parallele );
+	liberer_automate( deterministe );
+	liberer_automate( automate );
+
+	// Une explosion plus grande (2^10 états, avec une troisième lettre), 
+	// déterminisée avec 1 thread puis avec plusieurs : la renumérotation
+	// par un parcours en largeur rend les automates identiques, et non 
+	// seulement identiques à la numérotation près.
+	automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'c', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	for( i=1; i<10; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+		ajouter_transition( automate, i, 'c', i );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 10 );
+
+	deterministe = creer_automate_deterministe_parallele( automate, 1 );
+	TEST( taille_ensemble( get_etats( deterministe ) ) == 1024, result );
+	int nb_threads, memes = 1;
+	for( nb_threads=2; nb_threads<=8; nb_threads*=2 ){
+		parallele = creer_automate_deterministe_parallele( automate, nb_threads );
+		if( ! memes_automates( deterministe, parallele ) ) memes = 0;
+		liberer_automate( parallele );
+	}
+	TEST( memes, result );
+
+	liberer_automate( deterministe );
+	liberer_automate( automate );
+
+	// Les epsilon transitions sont d'abord retirées.
+	automate = creer_automate();
+	ajouter_epsilon_transition( automate, 1, 2 );
+	ajouter_transition( automate, 1, 'a', 1 );
+	ajouter_transition( automate, 2, 'b', 3 );
+	ajouter_transition( automate, 2, 'b', 1 );
+	ajouter_etat_initial( automate, 1 );
+	ajouter_etat_final( automate, 3 );
+
+	deterministe = creer_automate_deterministe( automate );
+	parallele = creer_automate_deterministe_parallele( automate, 0 );
+
+	TEST( 
+		1
+		&& est_deterministe( deterministe )
+		&& ! a_des_epsilon_transitions( deterministe )
+		&& memes_automates( deterministe, parallele )
+		&& le_mot_est_reconnu( deterministe, "b" )
+		&& le_mot_est_reconnu( deterministe, "aabbab" )
+		&& ! le_mot_est_reconnu( deterministe, "" )
+		&& ! le_mot_est_reconnu( deterministe, "ba" )
+		, result
+	);
+
+	liberer_automate( parallele );
+	liberer_automate( deterministe );
+	liberer_automate( automate );
+
+	return result;
+}
+
+int test_reconnaisseur(){
+	BEGIN_TEST;
+
+	int result = 1;
+
+	// Le déterminisé a 2^6 états : avec un budget de 8 états, la plupart 
+	// des mots sont lus en simulant l'automate.
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	int i;
+	for( i=1; i<6; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 6 );
+
+	Reconnaisseur * borne = creer_reconnaisseur( automate, 8 );
+	Reconnaisseur * complet = creer_reconnaisseur( automate, 0 );
+
+	char mot[10];
+	int longueur, code, identiques = 1, nb_mots = 0;
+	for( longueur=0; longueur<=9; longueur++ ){
+		for( code=0; code < (1<<longueur); code++ ){
+			for( i=0; i<longueur; i++ ){
+				mot[i] = ( code >> i ) & 1 ? 'b' : 'a';
+			}
+			mot[longueur] = '\0';
+			int attendu = le_mot_est_reconnu( automate, mot );
+			if( 
+				reconnaitre_mot( borne, mot ) != attendu
+				|| reconnaitre_mot( complet, mot ) != attendu
+			){
+				identiques = 0;
+			}
+			nb_mots++;
+		}
+	}
+	TEST( identiques, result );
+
+	Statistiques_reconnaisseur stats_borne = get_statistiques_reconnaisseur( borne );
+	Statistiques_reconnaisseur stats_complet = get_statistiques_reconnaisseur( complet );
+	TEST( 
+		1
+		&& stats_borne.budget_depasse
+		&& stats_borne.nb_etats == 8
+		&& stats_borne.nb_mots == nb_mots
+		&& stats_borne.nb_mots_simules > 0
+		&& stats_borne.nb_lettres_simulees > 0
+		&& stats_borne.nb_retours_deterministe > 0
+		, result
+	);
+	TEST( 
+		1
+		&& ! stats_complet.budget_depasse
+		&& stats_complet.nb_etats == 64
+		&& stats_complet.nb_mots_simules == 0
+		&& stats_complet.nb_lettres_simulees == 0
+		, result
+	);
+
+	// Une lettre hors de l'alphabet fait échouer la lecture.
+	TEST( ! reconnaitre_mot( borne, "aaaaaac" ), result );
+
+	liberer_reconnaisseur( complet );
+	liberer_reconnaisseur( borne );
+	liberer_automate( automate );
+
+	return result;
+}
+
+#define NB_THREADS_CACHE 4
+#define LONGUEUR_MAX_CACHE 9
+
+/*
+ * Lit tous les mots sur {a, b} de longueur au plus LONGUEUR_MAX_CACHE sur
+ * le cache, et compte les réponses différentes de celles attendues.
+ */
+typedef struct {
+	Cache_deterministe * cache;
+	const char * attendus;
+	int erreurs;
+} Lecture_cache;
+
+void* lire_mots_avec_cache( void* data ){
+	Lecture_cache * lecture = (Lecture_cache *) data;
+	char mot[ LONGUEUR_MAX_CACHE + 1 ];
+	int longueur, code, i, n = 0;
+	for( longueur=0; longueur<=LONGUEUR_MAX_CACHE; longueur++ ){
+		for( code=0; code < (1<<longueur); code++ ){
+			for( i=0; i<longueur; i++ ){
+				mot[i] = ( code >> i ) & 1 ? 'b' : 'a';
+			}
+			mot[longueur] = '\0';
+			if( reconnaitre_mot_avec_cache( lecture->cache, mot ) != lecture->attendus[n] ){
+				lecture->erreurs++;
+			}
+			n++;
+		}
+	}
+	return NULL;
+}
+
+/*
+ * Lit les mots avec NB_THREADS_CACHE threads en même temps, et renvoie le 
+ * nombre total d'erreurs.
+ */
+int lire_mots_en_parallele( Cache_deterministe * cache, const char * attendus ){
+	pthread_t threads[ NB_THREADS_CACHE ];
+	Lecture_cache lectures[ NB_THREADS_CACHE ];
+	int t, erreurs = 0;
+	for( t=0; t<NB_THREADS_CACHE; t++ ){
+		lectures[t].cache = cache;
+		lectures[t].attendus = attendus;
+		lectures[t].erreurs = 0;
+		pthread_create( &threads[t], NULL, lire_mots_avec_cache, &lectures[t] );
+	}
+	for( t=0; t<NB_THREADS_CACHE; t++ ){
+		pthread_join( threads[t], NULL );
+		erreurs += lectures[t].erreurs;
+	}
+	return erreurs;
+}
+
+int test_cache_deterministe(){
+	BEGIN_TEST;
+
+	int result = 1;
+
+	// Le déterminisé a 2^6 états.
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	int i;
+	for( i=1; i<6; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 6 );
+
+	// Les réponses attendues sont calculées à l'avance : 
+	// le_mot_est_reconnu() ne doit pas être appelé par plusieurs threads.
+	int nb_mots = ( 1 << ( LONGUEUR_MAX_CACHE + 1 ) ) - 1;
+	char * attendus = xmalloc( nb_mots );
+	char mot[ LONGUEUR_MAX_CACHE + 1 ];
+	int longueur, code, n = 0;
+	for( longueur=0; longueur<=LONGUEUR_MAX_CACHE; longueur++ ){
+		for( code=0; code < (1<<longueur); code++ ){
+			for( i=0; i<longueur; i++ ){
+				mot[i] = ( code >> i ) & 1 ? 'b' : 'a';
+			}
+			mot[longueur] = '\0';
+			attendus[n++] = le_mot_est_reconnu( automate, mot );
+		}
+	}
+
+	Cache_deterministe * cache = creer_cache_deterministe( automate, 0 );
+	int erreurs = lire_mots_en_parallele( cache, attendus );
+	TEST( erreurs == 0, result );
+	Statistiques_cache_deterministe stats = get_statistiques_cache_deterministe( cache );
+	TEST( 
+		1
+		&& stats.nb_etats == 64
+		&& stats.nb_mots == NB_THREADS_CACHE * nb_mots
+		&& stats.nb_transitions_calculees >= 2 * 64
+		&& stats.nb_lettres_simulees == 0
+		&& stats.nb_vidages == 0
+		, result
+	);
+	int reconnu = reconnaitre_mot_avec_cache( cache, "aaaaaac" );
+	TEST( ! reconnu, result );
+	liberer_cache_deterministe( cache );
+
+	// Avec peu de mémoire, le cache est vidé régulièrement.
+	cache = creer_cache_deterministe( automate, 1000 );
+	erreurs = lire_mots_en_parallele( cache, attendus );
+	TEST( erreurs == 0, result );
+	stats = get_statistiques_cache_deterministe( cache );
+	TEST( 
+		1
+		&& stats.memoire <= 1000
+		&& stats.nb_vidages > 0
+		&& stats.nb_lettres_simulees > 0
+		, result
+	);
+	liberer_cache_deterministe( cache );
+
+	xfree( attendus );
+	liberer_automate( automate );
+
+	return result;
+}
+
 int main(){
 	nb_test = 0;
 	nb_total_test = 0;
@@ -532,6 +1438,17 @@ int main(){
 	ajouter_test( test_creer_automate );
 	ajouter_test( test_mot_accepte );
 	ajouter_test( test_automate_vide );
+	ajouter_test( test_transitions_depuis );
+	ajouter_test( test_etats_accessibles );
+	ajouter_test( test_etats_co_accessibles );
+	ajouter_test( test_automate_emonde );
+	ajouter_test( test_index_des_predecesseurs );
+	ajouter_test( test_automate_des_sous_mots );
+	ajouter_test( test_epsilon_transitions );
+	ajouter_test( test_automate_sans_epsilon );
+	ajouter_test( test_automate_deterministe );
+	ajouter_test( test_reconnaisseur );
+	ajouter_test( test_cache_deterministe );
 
 	set_all_sigactions();
 	
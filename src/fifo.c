@@ -22,62 +22,92 @@
 #include "outils.h"
 #include "fifo.h"
 
-typedef struct _List List;
+#include <string.h>
 
-struct _List {
-	List * next;
-	intptr_t element;
-};
+#define CAPACITE_INITIALE_FIFO 16
 
+/*
+ * Les 'nb' éléments de la file occupent les cases 'debut', 'debut'+1, ...
+ * du tableau, modulo sa capacité, qui est toujours une puissance de 2.
+ */
 struct _Fifo {
-	List * list;
+	intptr_t * elements;
+	size_t capacite;
+	size_t debut;
+	size_t nb;
 };
 
-List* allouer_list( List * next, intptr_t element ){
-	List* res = (List*) xmalloc( sizeof(List) );
-	res->next = next;
-	res->element = element;
-	return res;
-}
-
-void liberer_list( List * list ){
-	xfree( list );
+/*
+ * Double la capacité de la file, en remettant ses éléments dans l'ordre au
+ * début du nouveau tableau.
+ */
+void agrandir_fifo( Fifo* fifo ){
+	size_t capacite = 2 * fifo->capacite;
+	intptr_t * elements = xmalloc( capacite * sizeof(intptr_t) );
+	size_t fin = fifo->capacite - fifo->debut;
+	if( fin > fifo->nb ){
+		fin = fifo->nb;
+	}
+	memcpy( elements, fifo->elements + fifo->debut, fin * sizeof(intptr_t) );
+	memcpy(
+		elements + fin, fifo->elements, ( fifo->nb - fin ) * sizeof(intptr_t)
+	);
+	xfree( fifo->elements );
+	fifo->elements = elements;
+	fifo->capacite = capacite;
+	fifo->debut = 0;
 }
 
 void ajouter_fifo( Fifo* fifo, intptr_t element ){
-	fifo->list = allouer_list( fifo->list, element );
+	if( fifo->nb == fifo->capacite ){
+		agrandir_fifo( fifo );
+	}
+	fifo->elements[
+		( fifo->debut + fifo->nb ) & ( fifo->capacite - 1 )
+	] = element;
+	fifo->nb++;
 }
 
 intptr_t retirer_fifo( Fifo* fifo ){
-	intptr_t res = fifo->list->element;
-	List* tmp = fifo->list;
-	fifo->list = fifo->list->next;
-	liberer_list( tmp );
+	if( fifo->nb == 0 ){
+		ERREUR( "La file est vide." );
+	}
+	intptr_t res = fifo->elements[ fifo->debut ];
+	fifo->debut = ( fifo->debut + 1 ) & ( fifo->capacite - 1 );
+	fifo->nb--;
 	return res;
 }
 
 intptr_t obtenir_fifo( Fifo* fifo ){
-	return fifo->list->element;
+	if( fifo->nb == 0 ){
+		ERREUR( "La file est vide." );
+	}
+	return fifo->elements[ fifo->debut ];
 }
 
 int est_vide( Fifo* fifo ){
-	return fifo->list == NULL;
+	return fifo->nb == 0;
+}
+
+size_t taille_fifo( const Fifo* fifo ){
+	return fifo->nb;
+}
+
+void vider_fifo( Fifo* fifo ){
+	fifo->debut = 0;
+	fifo->nb = 0;
 }
 
 Fifo* creer_fifo(){
 	Fifo* res = xmalloc( sizeof(Fifo) );
-	res->list = NULL;
+	res->capacite = CAPACITE_INITIALE_FIFO;
+	res->elements = xmalloc( res->capacite * sizeof(intptr_t) );
+	res->debut = 0;
+	res->nb = 0;
 	return res;
 }
 
-void vider_list( List * list ){
-	if( list ){
-		vider_list( list->next );
-		xfree( list );
-	}
-}
-
-void liberer_fifo( Fifo* file ){
-	vider_list( file->list );
-	xfree( file );
+void liberer_fifo( Fifo* fifo ){
+	xfree( fifo->elements );
+	xfree( fifo );
 }
@@ -22,13 +22,18 @@
 #ifndef __FIFO_H__
 #define __FIFO_H__
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*
  * Définit le type d'une file first-in first-out contenant des entiers ou 
- * des pointerus vers des stucture plus complexes.
+ * des pointeurs vers des structures plus complexes.
  * La file n'est pas responsable de la mémoire des éléments qui y sont 
  * entreposés.
+ *
+ * La file est rangée dans un tableau circulaire dont la capacité double 
+ * lorsqu'il est plein : ajouter et retirer un élément se font en temps 
+ * constant (amorti pour l'ajout).
  */
 typedef struct _Fifo Fifo;
 
@@ -38,8 +43,8 @@ typedef struct _Fifo Fifo;
 Fifo* creer_fifo();
 
 /*
- * Supprimme la mémoire associée à la file.
- * La mamoir associée aux élément de la file ne sont pas supprimé.
+ * Supprime la mémoire associée à la file.
+ * La mémoire associée aux éléments de la file n'est pas supprimée.
  */
 void liberer_fifo( Fifo* fifo );
 
@@ -49,19 +54,31 @@ void liberer_fifo( Fifo* fifo );
 int est_vide( Fifo* fifo );
 
 /*
- * Ajoute un élément au dessus de la pile.
+ * Renvoie le nombre d'éléments de la file.
+ */
+size_t taille_fifo( const Fifo* fifo );
+
+/*
+ * Ajoute un élément à la fin de la file.
  */
 void ajouter_fifo( Fifo* fifo, intptr_t element );
 
 /*
- * Retire un élément du dessus de la pile et le renvoie.
+ * Retire l'élément du début de la file et le renvoie.
+ * La file ne doit pas être vide.
  */
 intptr_t retirer_fifo( Fifo* fifo );
 
 /*
- * Renvoie l'élement qui se trouve au dessus de la pile. L'élément n'est pas
- * retiré de la pile.
+ * Renvoie l'élement qui se trouve au début de la file, c'est à dire le
+ * prochain élément renvoyé par retirer_fifo(). L'élément n'est pas retiré
+ * de la file.
  */
 intptr_t obtenir_fifo( Fifo* fifo );
 
+/*
+ * Retire tous les éléments de la file, sans libérer son tableau.
+ */
+void vider_fifo( Fifo* fifo );
+
 #endif
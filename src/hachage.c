@@ -0,0 +1,230 @@
+/*
+ *   Ce fichier fait parti d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux 1
+ *
+ *   Copyright (C) 2014 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "hachage.h"
+#include "outils.h"
+
+#include <string.h>
+
+/* Capacité initiale d'une table de hachage. C'est une puissance de 2. */
+#define CAPACITE_INITIALE_HACHAGE 8
+
+struct _Hachage {
+	Hachage_case * cases;
+	size_t capacite;
+	size_t nb;
+	unsigned long (*hacher_cle)( const intptr_t cle );
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 );
+};
+
+/*
+ * Mélange les bits de la valeur de hachage fournie par l'utilisateur (qui
+ * est souvent l'identité pour des entiers), afin que les bits de poids 
+ * faibles, qui servent à choisir la case, soient bien répartis.
+ * Le résultat n'est jamais nul, 0 étant réservé aux cases libres.
+ */
+unsigned long melanger_hachage( unsigned long h ){
+	uint64_t x = (uint64_t) h;
+	x ^= x >> 33;
+	x *= UINT64_C(0xff51afd7ed558ccd);
+	x ^= x >> 33;
+	x *= UINT64_C(0xc4ceb9fe1a85ec53);
+	x ^= x >> 33;
+	return x ? (unsigned long) x : 1;
+}
+
+unsigned long hacher_hachage( const Hachage* hachage, const intptr_t cle ){
+	if( hachage->hacher_cle ){
+		return melanger_hachage( hachage->hacher_cle( cle ) );
+	}
+	return melanger_hachage( (unsigned long) cle );
+}
+
+int cles_egales_hachage( 
+	const Hachage* hachage, const intptr_t cle1, const intptr_t cle2
+){
+	if( hachage->comparer_cle ){
+		return hachage->comparer_cle( cle1, cle2 ) == 0;
+	}
+	return cle1 == cle2;
+}
+
+Hachage_case* allouer_cases_hachage( size_t capacite ){
+	Hachage_case* cases = xmalloc( capacite * sizeof(Hachage_case) );
+	memset( cases, 0, capacite * sizeof(Hachage_case) );
+	return cases;
+}
+
+Hachage* creer_hachage(
+	unsigned long (*hacher_cle)( const intptr_t cle ),
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 )
+){
+	Hachage* res = xmalloc( sizeof(Hachage) );
+	res->capacite = CAPACITE_INITIALE_HACHAGE;
+	res->cases = allouer_cases_hachage( res->capacite );
+	res->nb = 0;
+	res->hacher_cle = hacher_cle;
+	res->comparer_cle = comparer_cle;
+	return res;
+}
+
+void liberer_hachage( Hachage* hachage ){
+	xfree( hachage->cases );
+	xfree( hachage );
+}
+
+void vider_hachage( Hachage* hachage ){
+	memset( hachage->cases, 0, hachage->capacite * sizeof(Hachage_case) );
+	hachage->nb = 0;
+}
+
+Hachage* copier_hachage( const Hachage* hachage ){
+	Hachage* res = xmalloc( sizeof(Hachage) );
+	*res = *hachage;
+	res->cases = xmalloc( hachage->capacite * sizeof(Hachage_case) );
+	memcpy( 
+		res->cases, hachage->cases, hachage->capacite * sizeof(Hachage_case)
+	);
+	return res;
+}
+
+size_t taille_hachage( const Hachage* hachage ){
+	return hachage->nb;
+}
+
+size_t memoire_hachage( const Hachage* hachage ){
+	return sizeof( Hachage ) + hachage->capacite * sizeof( Hachage_case );
+}
+
+/*
+ * Renvoie la case contenant la clé, ou la case libre où il faudrait la 
+ * ranger.
+ */
+Hachage_case* sonder_hachage( 
+	const Hachage* hachage, const intptr_t cle, unsigned long h
+){
+	size_t masque = hachage->capacite - 1;
+	size_t i = h & masque;
+	while( hachage->cases[i].hachage ){
+		if( 
+			hachage->cases[i].hachage == h 
+			&& cles_egales_hachage( hachage, hachage->cases[i].cle, cle )
+		){
+			break;
+		}
+		i = ( i + 1 ) & masque;
+	}
+	return &hachage->cases[i];
+}
+
+Hachage_case* chercher_hachage( const Hachage* hachage, const intptr_t cle ){
+	Hachage_case* c = sonder_hachage( 
+		hachage, cle, hacher_hachage( hachage, cle ) 
+	);
+	return c->hachage ? c : NULL;
+}
+
+void agrandir_hachage( Hachage* hachage ){
+	Hachage_case* anciennes = hachage->cases;
+	size_t ancienne_capacite = hachage->capacite;
+	size_t i;
+
+	hachage->capacite *= 2;
+	hachage->cases = allouer_cases_hachage( hachage->capacite );
+	for( i=0; i<ancienne_capacite; i++ ){
+		if( anciennes[i].hachage ){
+			size_t masque = hachage->capacite - 1;
+			size_t j = anciennes[i].hachage & masque;
+			while( hachage->cases[j].hachage ) j = ( j + 1 ) & masque;
+			hachage->cases[j] = anciennes[i];
+		}
+	}
+	xfree( anciennes );
+}
+
+Hachage_case* inserer_hachage( 
+	Hachage* hachage, const intptr_t cle, int* nouvelle 
+){
+	unsigned long h = hacher_hachage( hachage, cle );
+	Hachage_case* c = sonder_hachage( hachage, cle, h );
+	if( c->hachage ){
+		*nouvelle = 0;
+		return c;
+	}
+	// On garde un taux de remplissage inférieur à 3/4.
+	if( 4 * ( hachage->nb + 1 ) > 3 * hachage->capacite ){
+		agrandir_hachage( hachage );
+		c = sonder_hachage( hachage, cle, h );
+	}
+	c->hachage = h;
+	c->cle = cle;
+	c->valeur = 0;
+	hachage->nb++;
+	*nouvelle = 1;
+	return c;
+}
+
+int retirer_hachage( 
+	Hachage* hachage, const intptr_t cle, Hachage_case* retiree
+){
+	Hachage_case* c = chercher_hachage( hachage, cle );
+	if( ! c ) return 0;
+	if( retiree ) *retiree = *c;
+
+	// Suppression par décalage arrière : on ramène dans le trou les cases 
+	// suivantes qui ne sont pas à leur place idéale, ce qui évite les 
+	// marqueurs de suppression.
+	size_t masque = hachage->capacite - 1;
+	size_t trou = c - hachage->cases;
+	size_t i = trou;
+	for(;;){
+		i = ( i + 1 ) & masque;
+		if( ! hachage->cases[i].hachage ) break;
+		size_t ideal = hachage->cases[i].hachage & masque;
+		// La case i peut être déplacée dans le trou si sa position idéale
+		// n'est pas située (cycliquement) dans ]trou, i].
+		if( ( ( i - ideal ) & masque ) >= ( ( i - trou ) & masque ) ){
+			hachage->cases[trou] = hachage->cases[i];
+			trou = i;
+		}
+	}
+	hachage->cases[trou].hachage = 0;
+	hachage->nb--;
+	return 1;
+}
+
+Hachage_case* premiere_case_hachage( const Hachage* hachage ){
+	size_t i;
+	for( i=0; i<hachage->capacite; i++ ){
+		if( hachage->cases[i].hachage ) return &hachage->cases[i];
+	}
+	return NULL;
+}
+
+Hachage_case* case_suivante_hachage( 
+	const Hachage* hachage, const Hachage_case* courante
+){
+	size_t i;
+	for( i = courante - hachage->cases + 1; i<hachage->capacite; i++ ){
+		if( hachage->cases[i].hachage ) return &hachage->cases[i];
+	}
+	return NULL;
+}
@@ -0,0 +1,138 @@
+/*
+ *   Ce fichier fait parti d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux 1
+ *
+ *   Copyright (C) 2014 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef __HACHAGE_H__
+#define __HACHAGE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Table de hachage à adressage ouvert (sondage linéaire) associant une valeur
+ * à une clé. Les clés et les valeurs sont codées par le type intptr_t.
+ *
+ * Les associations sont rangées directement dans un tableau contigu de cases.
+ * Une recherche ne fait donc, en moyenne, qu'un accès mémoire, et ne compare
+ * que les clés dont la valeur de hachage est identique.
+ *
+ * La table de hachage ne gère pas la mémoire des clés et des valeurs.
+ */
+typedef struct _Hachage Hachage;
+
+/*
+ * Une case de la table de hachage. Une case dont le champ 'hachage' vaut 0
+ * est libre.
+ */
+typedef struct _Hachage_case {
+	unsigned long hachage;
+	intptr_t cle;
+	intptr_t valeur;
+} Hachage_case;
+
+/*
+ * Crée une table de hachage vide.
+ *
+ * Si 'hacher_cle' vaut NULL, les clés sont considérées comme des entiers et
+ * hachées directement. Si 'comparer_cle' vaut NULL, deux clés sont égales
+ * si elles sont égales en tant qu'entiers ; sinon, elles sont égales si 
+ * 'comparer_cle' renvoie 0.
+ */
+Hachage* creer_hachage(
+	unsigned long (*hacher_cle)( const intptr_t cle ),
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 )
+);
+
+/*
+ * Mélange les bits d'une valeur de hachage, pour que ses bits de poids 
+ * faibles soient bien répartis. Le résultat n'est jamais nul.
+ */
+unsigned long melanger_hachage( unsigned long h );
+
+/*
+ * Libère la table de hachage (mais ni ses clés, ni ses valeurs).
+ */
+void liberer_hachage( Hachage* hachage );
+
+/*
+ * Retire toutes les associations de la table de hachage.
+ */
+void vider_hachage( Hachage* hachage );
+
+/*
+ * Renvoie une copie de la table de hachage. Les clés et les valeurs sont 
+ * recopiées telles quelles.
+ */
+Hachage* copier_hachage( const Hachage* hachage );
+
+/*
+ * Renvoie le nombre d'associations de la table de hachage.
+ */
+size_t taille_hachage( const Hachage* hachage );
+
+/*
+ * Renvoie la mémoire occupée par la table de hachage et ses cases, en 
+ * octets.
+ */
+size_t memoire_hachage( const Hachage* hachage );
+
+/*
+ * Renvoie la case contenant la clé passée en paramètre, ou NULL si la clé
+ * n'est pas dans la table.
+ */
+Hachage_case* chercher_hachage( const Hachage* hachage, const intptr_t cle );
+
+/*
+ * Renvoie la case contenant la clé passée en paramètre. Si la clé n'est pas
+ * dans la table, une case lui est réservée, sa valeur est mise à 0, et
+ * '*nouvelle' est mis à 1 (à 0 sinon). L'appelant peut alors remplacer
+ * la clé de la case par une copie qui lui est égale.
+ *
+ * Les pointeurs vers les cases obtenus auparavant ne sont plus valides.
+ */
+Hachage_case* inserer_hachage( 
+	Hachage* hachage, const intptr_t cle, int* nouvelle 
+);
+
+/*
+ * Retire la clé passée en paramètre de la table. Si la clé était présente, 
+ * l'association retirée est recopiée dans '*retiree' et la fonction renvoie 
+ * 1. Sinon, elle renvoie 0.
+ *
+ * Les pointeurs vers les cases obtenus auparavant ne sont plus valides.
+ */
+int retirer_hachage( 
+	Hachage* hachage, const intptr_t cle, Hachage_case* retiree
+);
+
+/*
+ * Parcours des cases occupées, dans un ordre quelconque : 
+ *
+ *   Hachage_case * c;
+ *   for( c = premiere_case_hachage( h ); c; c = case_suivante_hachage( h, c ) )
+ *       ...
+ */
+Hachage_case* premiere_case_hachage( const Hachage* hachage );
+Hachage_case* case_suivante_hachage( 
+	const Hachage* hachage, const Hachage_case* courante
+);
+
+#endif
@@ -22,9 +22,13 @@
 #include "outils.h"
 #include "fifo.h"
 #include "avl.h"
+#include "tavl.h"
+#include "arbre_b.h"
+#include "hachage.h"
 
 #include <search.h>
 #include <stdlib.h>
+#include <string.h>
 
 typedef struct _Table_association {
 	void (*supprimer_cle)(intptr_t cle);
@@ -32,36 +36,166 @@ typedef struct _Table_association {
 	int (*comparer_cle)(const intptr_t cle1, const intptr_t cle2);
 	intptr_t cle;
 	intptr_t valeur;
+	// Pour les tables à clés de taille fixe, la clé est recopiée ici et 
+	// 'cle' pointe vers cette copie.
+	intptr_t cle_en_place[];
 } Table_association ;
 
+typedef enum {
+	TABLE_AVL,
+	TABLE_COUSUE,
+	TABLE_ARBRE_B,
+	TABLE_HACHAGE
+} Table_type;
+
 struct _Table {
 	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 );
 	intptr_t (*copier_cle)( const intptr_t cle );
 	void (*supprimer_cle)(intptr_t cle);
+	Table_type type;
+	size_t taille_cle;
 	struct avl_table * root;
+	struct tavl_table * arbre_cousu;
+	Arbre_b * arbre_b;
+	Hachage * hachage;
 };
 
+void verifier_table_ordonnee( const Table* table ){
+	if( table->type == TABLE_HACHAGE ){
+		ERREUR( "Cette opération n'est disponible que pour les tables ordonnées" );
+	}
+}
+
+Table_iterateur creer_iterateur_table( const Table* table ){
+	Table_iterateur it;
+	it.table = table;
+	if( table->type == TABLE_COUSUE ){
+		tavl_t_init( &it.parcours.tavl, table->arbre_cousu );
+	}else if( table->type == TABLE_ARBRE_B ){
+		it.parcours.arbre_b.arbre = table->arbre_b;
+		it.parcours.arbre_b.feuille = NULL;
+	}else{
+		it.parcours.avl.avl_node = NULL;
+	}
+	it.case_hachage = NULL;
+	return it;
+}
+
+/*
+ * Les fonctions suivantes, jusqu'à construire_arbre_table(), cachent la 
+ * différence entre les trois sortes d'arbres (AVL, AVL cousu et arbre B+) qui
+ * codent les tables ordonnées.
+ */
+
+/*
+ * Renvoie l'association sur laquelle est placé l'itérateur, ou NULL si 
+ * l'itérateur est vide ou porte sur une table de hachage.
+ */
+Table_association* association_courante( const Table_iterateur* it ){
+	if( it->table->type == TABLE_COUSUE ){
+		const struct tavl_node * noeud = it->parcours.tavl.tavl_node;
+		return noeud ? ( Table_association* ) noeud->tavl_data : NULL;
+	}
+	if( it->table->type == TABLE_ARBRE_B ){
+		return courant_arbre_b( &it->parcours.arbre_b );
+	}
+	if( it->table->type == TABLE_AVL ){
+		const struct avl_node * noeud = it->parcours.avl.avl_node;
+		return noeud ? ( Table_association* ) noeud->avl_data : NULL;
+	}
+	return NULL;
+}
+
+Table_association* premiere_association( Table_iterateur* it ){
+	if( it->table->type == TABLE_COUSUE ){
+		return tavl_t_first( &it->parcours.tavl, it->table->arbre_cousu );
+	}
+	if( it->table->type == TABLE_ARBRE_B ){
+		return premier_arbre_b( &it->parcours.arbre_b, it->table->arbre_b );
+	}
+	return avl_t_first( &it->parcours.avl, it->table->root );
+}
+
+Table_association* derniere_association( Table_iterateur* it ){
+	if( it->table->type == TABLE_COUSUE ){
+		return tavl_t_last( &it->parcours.tavl, it->table->arbre_cousu );
+	}
+	if( it->table->type == TABLE_ARBRE_B ){
+		return dernier_arbre_b( &it->parcours.arbre_b, it->table->arbre_b );
+	}
+	return avl_t_last( &it->parcours.avl, it->table->root );
+}
+
+Table_association* association_suivante( Table_iterateur* it ){
+	if( it->table->type == TABLE_COUSUE ){
+		return tavl_t_next( &it->parcours.tavl );
+	}
+	if( it->table->type == TABLE_ARBRE_B ){
+		return suivant_arbre_b( &it->parcours.arbre_b );
+	}
+	return avl_t_next( &it->parcours.avl );
+}
+
+Table_association* association_precedente( Table_iterateur* it ){
+	if( it->table->type == TABLE_COUSUE ){
+		return tavl_t_prev( &it->parcours.tavl );
+	}
+	if( it->table->type == TABLE_ARBRE_B ){
+		return precedent_arbre_b( &it->parcours.arbre_b );
+	}
+	return avl_t_prev( &it->parcours.avl );
+}
+
+Table_association* placer_sur_association( 
+	Table_iterateur* it, Table_association* modele
+){
+	if( it->table->type == TABLE_COUSUE ){
+		return tavl_t_find( &it->parcours.tavl, it->table->arbre_cousu, modele );
+	}
+	if( it->table->type == TABLE_ARBRE_B ){
+		return placer_arbre_b( &it->parcours.arbre_b, it->table->arbre_b, modele );
+	}
+	return avl_t_find( &it->parcours.avl, it->table->root, modele );
+}
 
 const intptr_t get_cle( Table_iterateur it ){
-	const Table_association * asso = ( const Table_association * ) avl_t_cur( &it );
-	return (const intptr_t) asso->cle;
+	if( it.case_hachage ){
+		return it.case_hachage->cle;
+	}
+	return (const intptr_t) association_courante( &it )->cle;
 }
 
 intptr_t get_valeur( Table_iterateur it ){
-	Table_association * asso = ( Table_association * ) avl_t_cur( &it );
-	return asso->valeur;
+	if( it.case_hachage ){
+		return it.case_hachage->valeur;
+	}
+	return association_courante( &it )->valeur;
+}
+
+intptr_t copier_cle_table( const Table* table, const intptr_t cle ){
+	if( table->copier_cle && cle ){
+		return table->copier_cle( cle );
+	}
+	return cle;
+}
+
+void supprimer_cle_table( const Table* table, intptr_t cle ){
+	if( table->supprimer_cle && cle ){
+		table->supprimer_cle( cle );
+	}
 }
 
 Table_association * creer_table_association(
 	const Table* table, const intptr_t cle, intptr_t valeur
 ){
 	Table_association * res = xmalloc(
-		sizeof( Table_association )
+		sizeof( Table_association ) + table->taille_cle
 	);
-	if( table->copier_cle && cle ){
-		res->cle = table->copier_cle( cle );
+	if( table->taille_cle ){
+		memcpy( res->cle_en_place, (const void*) cle, table->taille_cle );
+		res->cle = (intptr_t) res->cle_en_place;
 	}else{
-		res->cle = cle;
+		res->cle = copier_cle_table( table, cle );
 	}
 	res->valeur = valeur;
 	res->supprimer_cle = table->supprimer_cle;
@@ -70,15 +204,14 @@ Table_association * creer_table_association(
 	return res;
 }
 
-Table_association * copier_table_association( Table_association * asso ){
-	Table_association * res = xmalloc(
-		sizeof( Table_association )
-	);
-	*res = *asso;
-	if( asso->copier_cle && asso->cle ){
-		res->cle = asso->copier_cle( asso->cle );
-	}
-	return res;
+/*
+ * Renvoie une copie de l'association, dont la clé est copiée comme le fait
+ * la table 'table' à laquelle la copie est destinée.
+ */
+Table_association * copier_table_association( 
+	const Table* table, const Table_association * asso 
+){
+	return creer_table_association( table, asso->cle, asso->valeur );
 }
 
 int compare_table_association( const void * pa1, const void * pb1, void* param ){
@@ -97,6 +230,17 @@ int compare_table_association( const void * pa1, const void * pb1, void* param )
 }
 
 
+/*
+ * Initialise une association qui ne sert qu'à chercher la clé 'cle' dans la 
+ * table : la clé n'est pas copiée.
+ */
+void initialiser_modele_association( 
+	const Table* table, Table_association* modele, const intptr_t cle
+){
+	modele->comparer_cle = table->comparer_cle;
+	modele->cle = cle;
+}
+
 void supprimer_table_association2( void* asso_tmp, void* data ){
 	Table_association * asso = (Table_association*) asso_tmp;
 	if( asso->supprimer_cle && asso->cle ){
@@ -112,13 +256,181 @@ void supprimer_table_association( Table_association * asso ){
 	xfree(asso);
 }
 
-Table* creer_table(
+/*
+ * Place l'itérateur, qui doit être vide, sur la plus petite association dont
+ * la clé est supérieure ou égale (strictement supérieure si 'strictement' est
+ * vrai) à celle de 'modele', et la renvoie. S'il n'y en a pas, l'itérateur 
+ * reste vide et NULL est renvoyé.
+ */
+Table_association* placer_sur_borne( 
+	Table_iterateur* it, const Table_association* modele, int strictement
+){
+	const Table* table = it->table;
+	if( table->type == TABLE_ARBRE_B ){
+		return placer_superieur_arbre_b( 
+			&it->parcours.arbre_b, table->arbre_b, modele, strictement
+		);
+	}
+	// On descend dans l'arbre en retenant la dernière association qui 
+	// convient, puis on y place l'itérateur.
+	Table_association* borne = NULL;
+	int cmp, dir;
+	if( table->type == TABLE_COUSUE ){
+		const struct tavl_node * noeud = table->arbre_cousu->tavl_root;
+		while( noeud ){
+			cmp = compare_table_association( modele, noeud->tavl_data, NULL );
+			dir = ! ( cmp < 0 || ( cmp == 0 && ! strictement ) );
+			if( dir == 0 ){
+				borne = noeud->tavl_data;
+			}
+			if( noeud->tavl_tag[dir] == TAVL_THREAD ) break;
+			noeud = noeud->tavl_link[dir];
+		}
+	}else{
+		const struct avl_node * noeud = table->root->avl_root;
+		while( noeud ){
+			cmp = compare_table_association( modele, noeud->avl_data, NULL );
+			dir = ! ( cmp < 0 || ( cmp == 0 && ! strictement ) );
+			if( dir == 0 ){
+				borne = noeud->avl_data;
+			}
+			noeud = noeud->avl_link[dir];
+		}
+	}
+	if( ! borne ) return NULL;
+	return placer_sur_association( it, borne );
+}
+
+void creer_arbre_table( Table* table ){
+	if( table->type == TABLE_COUSUE ){
+		table->arbre_cousu = tavl_create( compare_table_association, NULL, NULL );
+	}else if( table->type == TABLE_ARBRE_B ){
+		table->arbre_b = creer_arbre_b( compare_table_association, NULL );
+	}else{
+		table->root = avl_create( compare_table_association, NULL, NULL );
+	}
+}
+
+/*
+ * Libère l'arbre de la table. Si 'supprimer' n'est pas NULL, la fonction est
+ * appliquée à chaque association.
+ */
+void detruire_arbre_table( Table* table, avl_item_func * supprimer ){
+	if( table->type == TABLE_COUSUE ){
+		tavl_destroy( table->arbre_cousu, supprimer );
+	}else if( table->type == TABLE_ARBRE_B ){
+		liberer_arbre_b( table->arbre_b, supprimer );
+	}else{
+		avl_destroy( table->root, supprimer );
+	}
+}
+
+void* creer_association_comme( const void* modele, void* table ){
+	return creer_table_association( 
+		(Table*) table, ( (const Table_association*) modele )->cle, 
+		(intptr_t) NULL 
+	);
+}
+
+/*
+ * Cherche l'association de même clé que 'modele' et renvoie l'adresse de la
+ * case de l'arbre qui la contient. S'il n'y en a pas, une nouvelle association
+ * (avec une copie de la clé et la valeur NULL) est d'abord insérée, et 
+ * '*ajout' est mis à 1.
+ */
+Table_association** sonder_association( 
+	Table* table, const Table_association* modele, int* ajout 
+){
+	void** val;
+	if( table->type == TABLE_ARBRE_B ){
+		// Les éléments d'un arbre B+ servent aussi de séparateurs : 
+		// l'association doit être créée avant d'être rangée.
+		val = sonder_arbre_b( 
+			table->arbre_b, modele, creer_association_comme, table, ajout 
+		);
+	}else{
+		// Le modèle est inséré tel quel, puis remplacé dans sa case par une 
+		// vraie association.
+		if( table->type == TABLE_COUSUE ){
+			val = tavl_probe( table->arbre_cousu, (void*) modele );
+		}else{
+			val = avl_probe( table->root, (void*) modele );
+		}
+		*ajout = ( val && *val == modele );
+		if( *ajout ){
+			*val = creer_association_comme( modele, table );
+		}
+	}
+	if( val == NULL ){
+		ERREUR( "Espace insuffisant" );
+	}
+	return ( Table_association** ) val;
+}
+
+/*
+ * Retire de l'arbre l'association de même clé que 'modele' et la renvoie, ou
+ * renvoie NULL si une telle association n'existe pas.
+ */
+Table_association* retirer_association( 
+	Table* table, const Table_association* modele
+){
+	if( table->type == TABLE_COUSUE ){
+		return tavl_delete( table->arbre_cousu, (const void*) modele );
+	}
+	if( table->type == TABLE_ARBRE_B ){
+		return retirer_arbre_b( table->arbre_b, (const void*) modele );
+	}
+	return avl_delete( table->root, (const void*) modele );
+}
+
+size_t nombre_associations( const Table* table ){
+	if( table->type == TABLE_COUSUE ){
+		return tavl_count( table->arbre_cousu );
+	}
+	if( table->type == TABLE_ARBRE_B ){
+		return taille_arbre_b( table->arbre_b );
+	}
+	return avl_count( table->root );
+}
+
+/*
+ * Remplit l'arbre, qui doit être vide, avec les 'nb' associations triées de 
+ * 'assos'.
+ */
+void construire_arbre_table( 
+	Table* table, Table_association** assos, size_t nb 
+){
+	int ok;
+	if( table->type == TABLE_ARBRE_B ){
+		construire_arbre_b( table->arbre_b, (void**) assos, nb );
+		return;
+	}
+	if( table->type == TABLE_COUSUE ){
+		ok = tavl_build( table->arbre_cousu, (void**) assos, nb );
+	}else{
+		ok = avl_build( table->root, (void**) assos, nb );
+	}
+	if( ! ok ){
+		ERREUR( "Espace insuffisant" );
+	}
+}
+
+Table_association** allouer_associations( size_t nb );
+void reconstruire_table( Table* table, Table_association** assos, size_t nb );
+
+Table* allouer_table(
+	Table_type type,
 	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
 	intptr_t (*copier_cle)( const intptr_t cle ),
 	void (*supprimer_cle)(intptr_t cle)
 ){
 	Table* res = xmalloc( sizeof(Table) );
-	res->root = avl_create ( compare_table_association, NULL, NULL );
+	res->type = type;
+	res->taille_cle = 0;
+	res->root = NULL;
+	res->arbre_cousu = NULL;
+	res->arbre_b = NULL;
+	res->hachage = NULL;
 
 	res->supprimer_cle = supprimer_cle;
 	res->comparer_cle = comparer_cle;
@@ -126,40 +438,237 @@ Table* creer_table(
 	return res;
 }
 
+/*
+ * Renvoie une nouvelle table ordonnée vide, codée par le même genre d'arbre
+ * que 'modele' et ayant les mêmes fonctions de gestion des clés.
+ */
+Table* creer_table_comme( const Table* modele ){
+	Table* res = allouer_table(
+		modele->type, modele->comparer_cle, modele->copier_cle, 
+		modele->supprimer_cle
+	);
+	res->taille_cle = modele->taille_cle;
+	creer_arbre_table( res );
+	return res;
+}
+
+Table* creer_table(
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+){
+	Table* res = allouer_table( 
+		TABLE_AVL, comparer_cle, copier_cle, supprimer_cle
+	);
+	creer_arbre_table( res );
+	return res;
+}
+
+Table* creer_table_cousue(
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+){
+	Table* res = allouer_table( 
+		TABLE_COUSUE, comparer_cle, copier_cle, supprimer_cle
+	);
+	creer_arbre_table( res );
+	return res;
+}
+
+Table* creer_table_arbre_b(
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+){
+	Table* res = allouer_table( 
+		TABLE_ARBRE_B, comparer_cle, copier_cle, supprimer_cle
+	);
+	creer_arbre_table( res );
+	return res;
+}
+
+Table* creer_table_cles_fixes(
+	size_t taille_cle,
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 )
+){
+	if( taille_cle == 0 ){
+		ERREUR( "La taille des clés doit être strictement positive" );
+	}
+	Table* res = allouer_table( TABLE_AVL, comparer_cle, NULL, NULL );
+	res->taille_cle = taille_cle;
+	creer_arbre_table( res );
+	return res;
+}
+
+Table* creer_table_hachage(
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle),
+	unsigned long (*hacher_cle)( const intptr_t cle )
+){
+	Table* res = allouer_table( 
+		TABLE_HACHAGE, comparer_cle, copier_cle, supprimer_cle
+	);
+	res->hachage = creer_hachage( hacher_cle, comparer_cle );
+	return res;
+}
+
+Table* creer_table_depuis_tableau_trie(
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle),
+	const intptr_t * cles, const intptr_t * valeurs, unsigned int nb
+){
+	Table* res = creer_table( comparer_cle, copier_cle, supprimer_cle );
+	Table_association** assos = allouer_associations( nb );
+	unsigned int i;
+	for( i=0; i<nb; i++ ){
+		assos[i] = creer_table_association( 
+			res, cles[i], valeurs ? valeurs[i] : (intptr_t) NULL
+		);
+		if( i > 0 && compare_table_association( assos[i-1], assos[i], NULL ) >= 0 ){
+			ERREUR( "Les clés ne sont pas triées par ordre strictement croissant" );
+		}
+	}
+	reconstruire_table( res, assos, nb );
+	xfree( assos );
+	return res;
+}
+
+Table* copier_table( 
+	const Table* table, intptr_t (*copier_valeur)( const intptr_t valeur )
+){
+	if( table->type == TABLE_HACHAGE ){
+		Table* res = xmalloc( sizeof(Table) );
+		*res = *table;
+		res->hachage = copier_hachage( table->hachage );
+		Hachage_case* c;
+		for(
+			c = premiere_case_hachage( res->hachage ); c; 
+			c = case_suivante_hachage( res->hachage, c )
+		){
+			c->cle = copier_cle_table( table, c->cle );
+			if( copier_valeur ){
+				c->valeur = copier_valeur( c->valeur );
+			}
+		}
+		return res;
+	}
+
+	Table* res = creer_table_comme( table );
+	Table_association** assos = allouer_associations( taille_table( table ) );
+	Table_iterateur it = creer_iterateur_table( table );
+	Table_association* asso;
+	size_t nb = 0;
+	// Le parcours est ordonné : les copies sont donc déjà triées.
+	for(
+		asso = premiere_association( &it );
+		asso;
+		asso = association_suivante( &it )
+	){
+		assos[nb] = copier_table_association( res, asso );
+		if( copier_valeur ){
+			assos[nb]->valeur = copier_valeur( asso->valeur );
+		}
+		nb++;
+	}
+	reconstruire_table( res, assos, nb );
+	xfree( assos );
+	return res;
+}
+
+void supprimer_cles_hachage( const Table* table ){
+	Hachage_case* c;
+	for(
+		c = premiere_case_hachage( table->hachage ); c; 
+		c = case_suivante_hachage( table->hachage, c )
+	){
+		supprimer_cle_table( table, c->cle );
+	}
+}
+
 void liberer_table( Table* table ){
-	avl_destroy ( table->root, supprimer_table_association2 );
+	if( table->type == TABLE_HACHAGE ){
+		supprimer_cles_hachage( table );
+		liberer_hachage( table->hachage );
+	}else{
+		detruire_arbre_table( table, supprimer_table_association2 );
+	}
 	xfree( table );
 }
 
-void add_table( Table* table, const intptr_t cle, intptr_t valeur ) {
-	Table_association* asso = creer_table_association(table, cle, valeur);
-	void* val = avl_probe ( table->root, (void*) asso );
-	if( val == NULL ){
-		ERREUR( "Espace insuffisant" );
+intptr_t* trouver_ou_ajouter_table( 
+	Table* table, const intptr_t cle, int* nouvelle 
+){
+	int ajout;
+	intptr_t* valeur;
+	if( table->type == TABLE_HACHAGE ){
+		Hachage_case* c = inserer_hachage( table->hachage, cle, &ajout );
+		if( ajout ){
+			c->cle = copier_cle_table( table, cle );
+			c->valeur = (intptr_t) NULL;
+		}
+		valeur = &c->valeur;
+	}else{
+		Table_association modele;
+		initialiser_modele_association( table, &modele, cle );
+		valeur = &(*sonder_association( table, &modele, &ajout ))->valeur;
 	}
-	Table_association* asso_tree = *( Table_association** ) val; 
-	if( asso_tree != asso  ){
-		supprimer_table_association( asso );
-		asso_tree->valeur = valeur;
+	if( nouvelle ){
+		*nouvelle = ajout;
+	}
+	return valeur;
+}
+
+/*
+ * Renvoie l'association de même clé que 'modele', ou NULL si une telle 
+ * association n'existe pas. Aucun itérateur n'est construit.
+ */
+Table_association* chercher_association( 
+	const Table* table, const Table_association* modele
+){
+	if( table->type == TABLE_COUSUE ){
+		return tavl_find( table->arbre_cousu, modele );
 	}
+	if( table->type == TABLE_ARBRE_B ){
+		return chercher_arbre_b( table->arbre_b, modele );
+	}
+	return avl_find( table->root, modele );
+}
+
+const intptr_t* chercher_valeur_table( const Table* table, const intptr_t cle ){
+	if( table->type == TABLE_HACHAGE ){
+		const Hachage_case* c = chercher_hachage( table->hachage, cle );
+		return c ? &c->valeur : NULL;
+	}
+	Table_association modele;
+	initialiser_modele_association( table, &modele, cle );
+	const Table_association* asso = chercher_association( table, &modele );
+	return asso ? &asso->valeur : NULL;
+}
+
+void add_table( Table* table, const intptr_t cle, intptr_t valeur ) {
+	*trouver_ou_ajouter_table( table, cle, NULL ) = valeur;
 }
 
 intptr_t delete_table( Table* table, intptr_t cle ){
-	intptr_t valeur = (intptr_t) NULL;
-	Table_association* asso_tree = NULL;
-	Table_association* asso = creer_table_association(
-		table, cle, (intptr_t) NULL
-	);
-	void* val = avl_find( table->root, (void*) asso );
-	if( val ){
-		asso_tree = ( Table_association* ) val; 
-		valeur = asso_tree->valeur;
+	if( table->type == TABLE_HACHAGE ){
+		Hachage_case retiree;
+		if( retirer_hachage( table->hachage, cle, &retiree ) ){
+			supprimer_cle_table( table, retiree.cle );
+			return retiree.valeur;
+		}
+		return (intptr_t) NULL;
 	}
-	avl_delete( table->root, (void*) asso );
+	intptr_t valeur = (intptr_t) NULL;
+	Table_association modele;
+	initialiser_modele_association( table, &modele, cle );
+	Table_association* asso_tree = retirer_association( table, &modele );
 	if(asso_tree){
+		valeur = asso_tree->valeur;
 		supprimer_table_association( asso_tree );
 	}
-	supprimer_table_association( asso );
 	return valeur;
 }
 
@@ -168,11 +677,23 @@ void pour_toute_cle_valeur_table(
 	void (* action)( const intptr_t cle, intptr_t valeur, void* data  ),
 	void* data
 ){
-	struct avl_traverser traverser;
-	void * item;
-	avl_t_init( &traverser, table->root );
-	while( (item = avl_t_next( &traverser )) ){
-		Table_association* asso = (Table_association *) item;
+	if( table->type == TABLE_HACHAGE ){
+		Hachage_case* c;
+		for(
+			c = premiere_case_hachage( table->hachage ); c; 
+			c = case_suivante_hachage( table->hachage, c )
+		){
+			action( c->cle, c->valeur, data );
+		}
+		return;
+	}
+	Table_iterateur it = creer_iterateur_table( table );
+	Table_association* asso;
+	for(
+		asso = premiere_association( &it );
+		asso;
+		asso = association_suivante( &it )
+	){
 		action( asso->cle, asso->valeur, data );
 	}
 }
@@ -196,8 +717,170 @@ void pour_toute_valeur_table(
 }
 
 void vider_table( Table* table ){
-	avl_destroy ( table->root, supprimer_table_association2 );
-	table->root = avl_create ( compare_table_association, NULL, NULL );
+	if( table->type == TABLE_HACHAGE ){
+		supprimer_cles_hachage( table );
+		vider_hachage( table->hachage );
+		return;
+	}
+	detruire_arbre_table( table, supprimer_table_association2 );
+	creer_arbre_table( table );
+}
+
+unsigned int taille_table( const Table* table ){
+	if( table->type == TABLE_HACHAGE ){
+		return taille_hachage( table->hachage );
+	}
+	return nombre_associations( table );
+}
+
+size_t memoire_table( const Table* table ){
+	if( table->type == TABLE_HACHAGE ){
+		return sizeof( Table ) + memoire_hachage( table->hachage );
+	}
+	size_t associations = nombre_associations( table ) * ( 
+		sizeof( Table_association ) + table->taille_cle
+	);
+	if( table->type == TABLE_ARBRE_B ){
+		return sizeof( Table ) + memoire_arbre_b( table->arbre_b ) + associations;
+	}
+	if( table->type == TABLE_COUSUE ){
+		return sizeof( Table ) + sizeof( struct tavl_table ) + associations
+			+ nombre_associations( table ) * sizeof( struct tavl_node );
+	}
+	return sizeof( Table ) + sizeof( struct avl_table ) + associations
+		+ nombre_associations( table ) * sizeof( struct avl_node );
+}
+
+typedef enum {
+	FUSION_UNION,
+	FUSION_INTERSECTION,
+	FUSION_DIFFERENCE
+} Operation_fusion;
+
+void placer_association(
+	const Table* table, Table_association* asso, int garder, int en_place,
+	Table_association** res, size_t* nb
+){
+	if( garder ){
+		res[(*nb)++] = en_place ? asso : copier_table_association( table, asso );
+	}else if( en_place ){
+		supprimer_table_association( asso );
+	}
+}
+
+/*
+ * Parcourt en parallèle, et dans l'ordre, les associations des deux tables
+ * et range dans 'res' celles qui appartiennent au résultat de l'opération.
+ * Renvoie le nombre d'associations rangées dans 'res'.
+ *
+ * Les associations de table2 sont toujours recopiées. Celles de table1 sont
+ * recopiées si 'en_place' est faux ; sinon, elles sont déplacées dans 'res'
+ * et celles qui n'appartiennent pas au résultat sont libérées.
+ * Lorsqu'une clé est présente dans les deux tables, c'est l'association de 
+ * table1 qui est conservée.
+ */
+size_t fusionner_tables(
+	const Table* table1, const Table* table2, Operation_fusion operation,
+	int en_place, Table_association** res
+){
+	size_t nb = 0;
+	verifier_table_ordonnee( table1 );
+	verifier_table_ordonnee( table2 );
+	Table_iterateur it1 = creer_iterateur_table( table1 );
+	Table_iterateur it2 = creer_iterateur_table( table2 );
+	Table_association* a = premiere_association( &it1 );
+	Table_association* b = premiere_association( &it2 );
+
+	while( a || b ){
+		int cmp;
+		if( ! a ){
+			if( operation != FUSION_UNION ) break;
+			cmp = 1;
+		}else if( ! b ){
+			cmp = -1;
+		}else{
+			cmp = compare_table_association( a, b, NULL );
+		}
+
+		if( cmp < 0 ){
+			placer_association(
+				table1, a, operation != FUSION_INTERSECTION, en_place, res, &nb
+			);
+			a = association_suivante( &it1 );
+		}else if( cmp > 0 ){
+			if( operation == FUSION_UNION ){
+				res[nb++] = copier_table_association( table1, b );
+			}
+			b = association_suivante( &it2 );
+		}else{
+			placer_association(
+				table1, a, operation != FUSION_DIFFERENCE, en_place, res, &nb
+			);
+			a = association_suivante( &it1 );
+			b = association_suivante( &it2 );
+		}
+	}
+	return nb;
+}
+
+/*
+ * Remplace l'arbre de la table par un arbre parfaitement équilibré construit
+ * en temps linéaire à partir des 'nb' associations triées de 'assos'.
+ * Les noeuds de l'ancien arbre sont libérés, mais pas leurs associations.
+ */
+void reconstruire_table( Table* table, Table_association** assos, size_t nb ){
+	detruire_arbre_table( table, NULL );
+	creer_arbre_table( table );
+	construire_arbre_table( table, assos, nb );
+}
+
+Table_association** allouer_associations( size_t nb ){
+	return xmalloc( ( nb ? nb : 1 ) * sizeof( Table_association* ) );
+}
+
+Table* creer_fusion_table(
+	const Table* table1, const Table* table2, Operation_fusion operation
+){
+	verifier_table_ordonnee( table1 );
+	Table* res = creer_table_comme( table1 );
+	Table_association** assos = allouer_associations(
+		taille_table( table1 ) + taille_table( table2 )
+	);
+	size_t nb = fusionner_tables( table1, table2, operation, 0, assos );
+	reconstruire_table( res, assos, nb );
+	xfree( assos );
+	return res;
+}
+
+void fusionner_dans_table(
+	Table* table1, const Table* table2, Operation_fusion operation
+){
+	Table_association** assos = allouer_associations(
+		taille_table( table1 ) + taille_table( table2 )
+	);
+	size_t nb = fusionner_tables( table1, table2, operation, 1, assos );
+	reconstruire_table( table1, assos, nb );
+	xfree( assos );
+}
+
+Table* creer_union_table( const Table* table1, const Table* table2 ){
+	return creer_fusion_table( table1, table2, FUSION_UNION );
+}
+
+Table* creer_intersection_table( const Table* table1, const Table* table2 ){
+	return creer_fusion_table( table1, table2, FUSION_INTERSECTION );
+}
+
+Table* creer_difference_table( const Table* table1, const Table* table2 ){
+	return creer_fusion_table( table1, table2, FUSION_DIFFERENCE );
+}
+
+void union_dans_table( Table* table1, const Table* table2 ){
+	fusionner_dans_table( table1, table2, FUSION_UNION );
+}
+
+void intersection_dans_table( Table* table1, const Table* table2 ){
+	fusionner_dans_table( table1, table2, FUSION_INTERSECTION );
 }
 
 typedef struct {
@@ -236,40 +919,109 @@ void print_table(
 }
 
 Table_iterateur trouver_table( const Table* table, intptr_t cle ){
-	Table_iterateur it;
-	Table_association* asso = creer_table_association(
-		table, cle, (intptr_t) NULL
-	);
-	avl_t_find( &it, table->root, (void*) asso );
-	supprimer_table_association( asso );
+	Table_iterateur it = creer_iterateur_table( table );
+	if( table->type == TABLE_HACHAGE ){
+		it.case_hachage = chercher_hachage( table->hachage, cle );
+		return it;
+	}
+	Table_association modele;
+	initialiser_modele_association( table, &modele, cle );
+	placer_sur_association( &it, &modele );
+	return it;
+}
+
+/*
+ * Renvoie un itérateur placé sur la plus petite association de clé supérieure
+ * ou égale (strictement supérieure si 'strictement' est vrai) à 'cle'.
+ */
+Table_iterateur borne_inferieure_table( 
+	const Table* table, intptr_t cle, int strictement 
+){
+	Table_iterateur it = creer_iterateur_table( table );
+	verifier_table_ordonnee( table );
+	Table_association modele;
+	initialiser_modele_association( table, &modele, cle );
+	placer_sur_borne( &it, &modele, strictement );
 	return it;
 }
 
+Table_iterateur premier_iterateur_superieur_ou_egal_table( 
+	const Table* table, intptr_t cle
+){
+	return borne_inferieure_table( table, cle, 0 );
+}
+
+Table_iterateur premier_iterateur_superieur_table( 
+	const Table* table, intptr_t cle
+){
+	return borne_inferieure_table( table, cle, 1 );
+}
+
 Table_iterateur premier_iterateur_table( const Table* table ){
-	Table_iterateur it;
-	avl_t_first( &it, table->root );
+	Table_iterateur it = creer_iterateur_table( table );
+	verifier_table_ordonnee( table );
+	premiere_association( &it );
 	return it;
 }
 
 Table_iterateur dernier_iterateur_table(
 	const Table_iterateur * iterator, Table* table 
 ){
-	Table_iterateur it;
-	avl_t_last( &it, table->root );
+	Table_iterateur it = creer_iterateur_table( table );
+	verifier_table_ordonnee( table );
+	derniere_association( &it );
 	return it;
 }
 
 int iterateur_est_vide( Table_iterateur iterator ){
-	return avl_t_is_null( &iterator );	
+	return iterator.case_hachage == NULL && association_courante( &iterator ) == NULL;
 }
 
 Table_iterateur iterateur_suivant_table( Table_iterateur iterateur ){
-	avl_t_next( &iterateur );
+	verifier_table_ordonnee( iterateur.table );
+	association_suivante( &iterateur );
 	return iterateur;
 }
 
 Table_iterateur iterateur_precedent_table( Table_iterateur iterateur ){
-	avl_t_prev( &iterateur );
+	verifier_table_ordonnee( iterateur.table );
+	association_precedente( &iterateur );
 	return iterateur;
 }
 
+void placer_curseur_table( Table_curseur * curseur, const Table* table ){
+	*curseur = creer_iterateur_table( table );
+	if( table->type == TABLE_HACHAGE ){
+		curseur->case_hachage = premiere_case_hachage( table->hachage );
+	}else{
+		premiere_association( curseur );
+	}
+}
+
+void avancer_curseur_table( Table_curseur * curseur ){
+	if( curseur->case_hachage ){
+		curseur->case_hachage = case_suivante_hachage( 
+			curseur->table->hachage, curseur->case_hachage
+		);
+	}else{
+		association_suivante( curseur );
+	}
+}
+
+int curseur_table_est_vide( const Table_curseur * curseur ){
+	return curseur->case_hachage == NULL && association_courante( curseur ) == NULL;
+}
+
+intptr_t cle_du_curseur_table( const Table_curseur * curseur ){
+	if( curseur->case_hachage ){
+		return curseur->case_hachage->cle;
+	}
+	return association_courante( curseur )->cle;
+}
+
+intptr_t valeur_du_curseur_table( const Table_curseur * curseur ){
+	if( curseur->case_hachage ){
+		return curseur->case_hachage->valeur;
+	}
+	return association_courante( curseur )->valeur;
+}
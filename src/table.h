@@ -24,6 +24,8 @@
 
 #include <stdint.h>
 #include "avl.h"
+#include "tavl.h"
+#include "arbre_b.h"
 
 /*
  * Définit le type d'une table.
@@ -36,10 +38,39 @@
  */
 typedef struct _Table Table;
 
+struct _Hachage_case;
+
 /*
  * Définit le type d'un itérateur sur les éléments d'une table.
  */
-typedef struct avl_traverser Table_iterateur;
+typedef struct {
+	const Table * table;
+	union {
+		struct avl_traverser avl;
+		struct tavl_traverser tavl;
+		Arbre_b_parcours arbre_b;
+	} parcours;
+	struct _Hachage_case * case_hachage;
+} Table_iterateur;
+
+/*
+ * Définit le type d'un curseur sur les associations d'une table.
+ *
+ * Un curseur est un itérateur que l'on modifie sur place : les fonctions 
+ * placer_curseur_table(), avancer_curseur_table(), etc. prennent un pointeur 
+ * vers le curseur, au lieu de recopier l'itérateur à chaque pas comme le 
+ * font premier_iterateur_table() et iterateur_suivant_table().
+ *
+ * Table_curseur curseur;
+ * for(
+ *     placer_curseur_table( &curseur, table );
+ *     ! curseur_table_est_vide( &curseur );
+ *     avancer_curseur_table( &curseur )
+ * ){
+ *     printf( "%ld\n", cle_du_curseur_table( &curseur ) );
+ * }
+ */
+typedef Table_iterateur Table_curseur;
 
 /*
  * \brief Renvoie une nouvelle table.
@@ -152,6 +183,136 @@ Table* creer_table(
 	void (*supprimer_cle)(intptr_t cle)
 );
 
+/*
+ * Renvoie une nouvelle table contenant les 'nb' associations 
+ * ( cles[i], valeurs[i] ).
+ *
+ * Les clés doivent être triées par ordre strictement croissant (pour la 
+ * fonction de comparaison 'comparer_cle'). La table est alors construite 
+ * directement sous la forme d'un arbre parfaitement équilibré, en temps 
+ * linéaire.
+ * Les clés sont copiées comme dans add_table(). Si 'valeurs' vaut NULL, toutes
+ * les valeurs sont NULL.
+ */
+Table* creer_table_depuis_tableau_trie(
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle),
+	const intptr_t * cles, const intptr_t * valeurs, unsigned int nb
+);
+
+/*
+ * Renvoie une copie de la table, obtenue en temps linéaire sans aucune 
+ * comparaison de clés.
+ *
+ * Les clés sont copiées. Les valeurs sont copiées à l'aide de la fonction
+ * 'copier_valeur' ou, si ce paramètre vaut NULL, partagées entre les deux
+ * tables.
+ */
+Table* copier_table( 
+	const Table* table, intptr_t (*copier_valeur)( const intptr_t valeur )
+);
+
+/*
+ * Renvoie une nouvelle table ordonnée, codée par un arbre AVL cousu au lieu 
+ * d'un arbre AVL ordinaire.
+ *
+ * Les paramètres ont le même rôle que pour creer_table(), et la table 
+ * s'utilise exactement de la même manière.
+ *
+ * Dans un arbre cousu, chaque noeud sans fils gauche (resp. droit) pointe 
+ * directement vers son prédécesseur (resp. successeur). Les parcours 
+ * (pour_toute_cle_valeur_table(), les itérateurs, les curseurs, les unions, 
+ * etc.) passent donc d'une association à la suivante en suivant ces liens,
+ * sans pile, et les itérateurs ne sont jamais invalidés par un ajout.
+ * En contrepartie, les suppressions sont un peu plus coûteuses.
+ */
+Table* creer_table_cousue(
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+);
+
+/*
+ * \brief Renvoie une nouvelle table.
+ *
+ * Renvoie une nouvelle table ordonnée, codée par un arbre B+ au lieu d'un
+ * arbre AVL.
+ *
+ * Les paramètres ont le même rôle que pour creer_table(), et la table 
+ * s'utilise exactement de la même manière.
+ *
+ * Les associations sont rangées par paquets contigus dans des feuilles 
+ * chaînées entre elles, et chaque noeud occupe quelques lignes de cache :
+ * une recherche lit de l'ordre de log_16( n ) noeuds au lieu de log_2( n ), 
+ * et un parcours complet lit les feuilles les unes après les autres.
+ * C'est le codage à préférer pour les grandes tables ordonnées.
+ *
+ * En contrepartie, un itérateur ou un curseur n'est plus valide dès que la 
+ * table est modifiée.
+ */
+Table* creer_table_arbre_b(
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+);
+
+/*
+ * \brief Renvoie une nouvelle table dont les clés sont des valeurs de taille 
+ * fixe.
+ *
+ * Les clés sont des structures de 'taille_cle' octets qui ne contiennent 
+ * rien à libérer, par exemple : struct { int origine; int lettre; }.
+ * Comme pour creer_table(), une clé est passée aux fonctions de la table sous
+ * la forme d'un pointeur converti en intptr_t, et 'comparer_cle' compare deux
+ * tels pointeurs.
+ *
+ * Mais au lieu d'appeler une fonction de copie qui alloue une nouvelle clé,
+ * la table recopie les octets de la clé dans l'association elle-même : une 
+ * association ne coûte qu'une allocation, la clé est rangée à côté de sa 
+ * valeur en mémoire, et aucune fonction de copie ou de suppression n'est 
+ * nécessaire. get_cle() et cle_du_curseur_table() renvoient un pointeur 
+ * vers cette copie.
+ *
+ * La table est ordonnée et codée par un arbre AVL.
+ */
+Table* creer_table_cles_fixes(
+	size_t taille_cle,
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2)
+);
+
+/*
+ * Renvoie une nouvelle table, codée par une table de hachage à adressage 
+ * ouvert au lieu d'un arbre.
+ *
+ * Les paramètres 'comparer_cle', 'copier_cle' et 'supprimer_cle' ont le même
+ * rôle que pour creer_table() ; seule l'égalité des clés (comparer_cle 
+ * renvoie 0) est utilisée. La fonction 'hacher_cle' doit renvoyer la même 
+ * valeur pour deux clés égales. Si les clés sont des entiers, tous ces 
+ * paramètres peuvent valoir NULL.
+ *
+ * add_table(), delete_table() et trouver_table() s'exécutent alors en temps
+ * constant en moyenne et sans allocation de mémoire (hormis la copie de 
+ * la clé ajoutée et l'agrandissement, occasionnel, de la table).
+ *
+ * En contrepartie, la table n'est pas ordonnée :
+ *  - pour_toute_cle_valeur_table(), pour_toute_valeur_table() et 
+ *    print_table() parcourent les associations dans un ordre quelconque ;
+ *  - premier_iterateur_table(), iterateur_suivant_table(), 
+ *    iterateur_precedent_table(), creer_table_depuis_tableau_trie() ainsi 
+ *    que les fonctions d'union, d'intersection et de différence ne sont 
+ *    disponibles que pour les tables ordonnées (creer_table(), 
+ *    creer_table_cousue(), creer_table_arbre_b()). 
+ *    Un itérateur renvoyé par trouver_table() peut cependant être utilisé 
+ *    avec get_cle(), get_valeur() et iterateur_est_vide().
+ */
+Table* creer_table_hachage(
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle),
+	unsigned long (*hacher_cle)( const intptr_t cle )
+);
+
 /*
  * Cette fonction détruit une table. La mémoirei qui a été allouée par la table 
  * pour stocker les clés sont aussi détruitres. 
@@ -176,6 +337,29 @@ void liberer_table( Table* table );
  */
 void add_table( Table* table, const intptr_t cle, const intptr_t valeur );
 
+/*
+ * Cherche la clé dans la table et renvoie l'adresse de la valeur qui lui est
+ * associée. Si la clé n'est pas dans la table, elle y est d'abord ajoutée, 
+ * associée à la valeur NULL.
+ *
+ * La table n'est parcourue qu'une seule fois, et la clé n'est copiée (comme 
+ * dans add_table()) que si elle est réellement ajoutée.
+ * Si 'nouvelle' n'est pas NULL, *nouvelle vaut ensuite 1 si la clé a été 
+ * ajoutée et 0 sinon.
+ *
+ * L'adresse renvoyée n'est plus valide dès que la table est modifiée.
+ *
+ * Exemple :
+ *     int nouvelle;
+ *     intptr_t* valeur = trouver_ou_ajouter_table( table, cle, &nouvelle );
+ *     if( nouvelle ){
+ *         *valeur = (intptr_t) creer_ensemble( NULL, NULL, NULL );
+ *     }
+ */
+intptr_t* trouver_ou_ajouter_table( 
+	Table* table, const intptr_t cle, int* nouvelle 
+);
+
 
 /*
  * Supprime une clé de la table. La mémoire de la clé est libérée et la valeur
@@ -193,6 +377,51 @@ intptr_t delete_table( Table* table, const intptr_t cle );
  */
 void vider_table( Table* table );
 
+/*
+ * Renvoie le nombre d'associations contenues dans la table.
+ *
+ * Le nombre d'associations est maintenu par la table : la fonction s'exécute
+ * en temps constant.
+ */
+unsigned int taille_table( const Table* table );
+
+/*
+ * Renvoie la mémoire occupée par la table, en octets : sa structure, ses 
+ * cases ou ses noeuds, et ses associations (avec les clés rangées dans la 
+ * table, voir creer_table_cles_fixes()). La mémoire des clés copiées par 
+ * 'copier_cle' et celle vers laquelle pointent les valeurs ne sont pas 
+ * comptées.
+ *
+ * La fonction s'exécute en temps constant, sauf pour une table codée par un
+ * arbre B+, dont les noeuds sont parcourus.
+ */
+size_t memoire_table( const Table* table );
+
+/*
+ * Les fonctions suivantes créent une nouvelle table contenant 
+ * respectivement l'union, l'intersection et la différence des associations
+ * de deux tables, comparées par leurs clés.
+ *
+ * Lorsqu'une clé est présente dans les deux tables, c'est la valeur de 
+ * table1 qui est conservée. La table créée utilise les fonctions de 
+ * comparaison, de copie et de suppression des clés de table1.
+ *
+ * Les deux tables sont parcourues une seule fois, dans l'ordre, et le 
+ * résultat est construit directement sous la forme d'un arbre équilibré : 
+ * le coût est linéaire en la somme des tailles des deux tables.
+ */
+Table* creer_union_table( const Table* table1, const Table* table2 );
+Table* creer_intersection_table( const Table* table1, const Table* table2 );
+Table* creer_difference_table( const Table* table1, const Table* table2 );
+
+/*
+ * Versions en place de creer_union_table() et creer_intersection_table() : 
+ * le résultat est rangé dans table1. Les clés de table1 qui sont conservées
+ * ne sont pas recopiées.
+ */
+void union_dans_table( Table* table1, const Table* table2 );
+void intersection_dans_table( Table* table1, const Table* table2 );
+
 /*
  * Affiche la table. Vous devez donner en paramètres de print_table, des
  * fonctions pour afficher les clés et les valeurs.
@@ -251,6 +480,22 @@ void pour_toute_cle_valeur_table(
  */
 Table_iterateur trouver_table( const Table* table, const intptr_t cle );
 
+/*
+ * Renvoie l'adresse de la valeur associée à la clé, ou NULL si la clé n'est 
+ * pas dans la table.
+ *
+ * Contrairement à trouver_table(), aucun itérateur n'est construit ni copié :
+ * c'est la recherche à utiliser dans les boucles critiques.
+ * L'adresse renvoyée n'est plus valide dès que la table est modifiée.
+ *
+ * Exemple :
+ *     const intptr_t* valeur = chercher_valeur_table( table, cle );
+ *     if( valeur ){
+ *         printf( "valeur : %d \n", (int) *valeur );
+ *     }
+ */
+const intptr_t* chercher_valeur_table( const Table* table, const intptr_t cle );
+
 /*
  * Renvoie un itérateur positionné sur la première association de la table.
  *
@@ -259,6 +504,33 @@ Table_iterateur trouver_table( const Table* table, const intptr_t cle );
  */
 Table_iterateur premier_iterateur_table( const Table* table );
 
+/*
+ * Renvoie un itérateur positionné sur la plus petite association dont la clé
+ * est supérieure ou égale à la clé passée en paramètre, ou l'itérateur vide 
+ * si une telle association n'existe pas.
+ *
+ * La clé n'a pas besoin d'être présente dans la table. Avec 
+ * iterateur_suivant_table(), on parcourt ainsi les associations dont les clés
+ * sont comprises dans un intervalle en un temps proportionnel au nombre 
+ * d'associations parcourues (plus un temps logarithmique pour placer 
+ * l'itérateur), au lieu de chercher chaque clé possible de l'intervalle.
+ * L'itérateur renvoyé peut aussi servir de curseur (voir Table_curseur).
+ *
+ * Ces fonctions ne sont disponibles que pour les tables ordonnées.
+ */
+Table_iterateur premier_iterateur_superieur_ou_egal_table( 
+	const Table* table, const intptr_t cle
+);
+
+/*
+ * Renvoie un itérateur positionné sur la plus petite association dont la clé
+ * est strictement supérieure à la clé passée en paramètre, ou l'itérateur 
+ * vide si une telle association n'existe pas.
+ */
+Table_iterateur premier_iterateur_superieur_table( 
+	const Table* table, const intptr_t cle
+);
+
 /*
  * Renvoie l'iterateur suivant.
  *
@@ -304,5 +576,35 @@ const intptr_t get_cle( Table_iterateur it );
  */
 intptr_t get_valeur( Table_iterateur it );
 
+/*
+ * Place le curseur sur la première association de la table.
+ *
+ * Les associations d'une table ordonnée sont parcourues par ordre croissant 
+ * des clés. Celles d'une table de hachage sont parcourues dans un ordre 
+ * quelconque.
+ */
+void placer_curseur_table( Table_curseur * curseur, const Table* table );
+
+/*
+ * Déplace le curseur sur l'association suivante.
+ * Après la dernière association, le curseur devient vide.
+ */
+void avancer_curseur_table( Table_curseur * curseur );
+
+/*
+ * Renvoie 1 si le curseur est vide, 0 sinon.
+ */
+int curseur_table_est_vide( const Table_curseur * curseur );
+
+/*
+ * Renvoie la clé de l'association sur laquelle est placé le curseur.
+ */
+intptr_t cle_du_curseur_table( const Table_curseur * curseur );
+
+/*
+ * Renvoie la valeur de l'association sur laquelle est placé le curseur.
+ */
+intptr_t valeur_du_curseur_table( const Table_curseur * curseur );
+
 
 #endif
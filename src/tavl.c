@@ -0,0 +1,834 @@
+/* libavl - library for manipulation of binary trees.
+   Copyright (C) 1998-2002 Free Software Foundation, Inc.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of the
+   License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+   See the GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+   02111-1307, USA.
+
+   The author may be contacted at <blp@gnu.org> on the Internet, or
+   write to Ben Pfaff, Stanford University, Computer Science Dept., 353
+   Serra Mall, Stanford CA 94305, USA.
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "tavl.h"
+
+/* Creates and returns a new table
+   with comparison function |compare| using parameter |param|
+   and memory allocator |allocator|.
+   Returns |NULL| if memory allocation failed. */
+struct tavl_table *
+tavl_create (tavl_comparison_func *compare, void *param,
+             struct libavl_allocator *allocator)
+{
+  struct tavl_table *tree;
+
+  assert (compare != NULL);
+
+  if (allocator == NULL)
+    allocator = &avl_allocator_default;
+
+  tree = allocator->libavl_malloc (allocator, sizeof *tree);
+  if (tree == NULL)
+    return NULL;
+
+  tree->tavl_root = NULL;
+  tree->tavl_compare = compare;
+  tree->tavl_param = param;
+  tree->tavl_alloc = allocator;
+  tree->tavl_count = 0;
+
+  return tree;
+}
+
+/* Search |tree| for an item matching |item|, and return it if found.
+   Otherwise return |NULL|. */
+void *
+tavl_find (const struct tavl_table *tree, const void *item)
+{
+  const struct tavl_node *p;
+
+  assert (tree != NULL && item != NULL);
+
+  p = tree->tavl_root;
+  if (p == NULL)
+    return NULL;
+
+  for (;;)
+    {
+      int cmp, dir;
+
+      cmp = tree->tavl_compare (item, p->tavl_data, tree->tavl_param);
+      if (cmp == 0)
+        return p->tavl_data;
+
+      dir = cmp > 0;
+      if (p->tavl_tag[dir] == TAVL_CHILD)
+        p = p->tavl_link[dir];
+      else
+        return NULL;
+    }
+}
+
+/* Inserts |item| into |tree| and returns a pointer to |item|'s address.
+   If a duplicate item is found in the tree,
+   returns a pointer to the duplicate without inserting |item|.
+   Returns |NULL| in case of memory allocation failure. */
+void **
+tavl_probe (struct tavl_table *tree, void *item)
+{
+  struct tavl_node *y, *z; /* Top node to update balance factor, and parent. */
+  struct tavl_node *p, *q; /* Iterator, and parent. */
+  struct tavl_node *n;     /* Newly inserted node. */
+  struct tavl_node *w;     /* New root of rebalanced subtree. */
+  int dir;                 /* Direction to descend. */
+
+  unsigned char da[TAVL_MAX_HEIGHT]; /* Cached comparison results. */
+  int k = 0;              /* Number of cached results. */
+
+  assert (tree != NULL && item != NULL);
+
+  z = (struct tavl_node *) &tree->tavl_root;
+  y = tree->tavl_root;
+  if (y != NULL)
+    {
+      for (q = z, p = y; ; q = p, p = p->tavl_link[dir])
+        {
+          int cmp = tree->tavl_compare (item, p->tavl_data, tree->tavl_param);
+          if (cmp == 0)
+            return &p->tavl_data;
+
+          if (p->tavl_balance != 0)
+            z = q, y = p, k = 0;
+          da[k++] = dir = cmp > 0;
+
+          if (p->tavl_tag[dir] == TAVL_THREAD)
+            break;
+        }
+    }
+  else
+    {
+      p = z;
+      dir = 0;
+    }
+
+  n = tree->tavl_alloc->libavl_malloc (tree->tavl_alloc, sizeof *n);
+  if (n == NULL)
+    return NULL;
+
+  tree->tavl_count++;
+  n->tavl_data = item;
+  n->tavl_tag[0] = n->tavl_tag[1] = TAVL_THREAD;
+  n->tavl_link[dir] = p->tavl_link[dir];
+  if (tree->tavl_root != NULL)
+    {
+      p->tavl_tag[dir] = TAVL_CHILD;
+      n->tavl_link[!dir] = p;
+    }
+  else
+    n->tavl_link[1] = NULL;
+  p->tavl_link[dir] = n;
+  n->tavl_balance = 0;
+  if (tree->tavl_root == n)
+    return &n->tavl_data;
+
+  for (p = y, k = 0; p != n; p = p->tavl_link[da[k]], k++)
+    if (da[k] == 0)
+      p->tavl_balance--;
+    else
+      p->tavl_balance++;
+
+  if (y->tavl_balance == -2)
+    {
+      struct tavl_node *x = y->tavl_link[0];
+      if (x->tavl_balance == -1)
+        {
+          w = x;
+          if (x->tavl_tag[1] == TAVL_THREAD)
+            {
+              x->tavl_tag[1] = TAVL_CHILD;
+              y->tavl_tag[0] = TAVL_THREAD;
+              y->tavl_link[0] = x;
+            }
+          else
+            y->tavl_link[0] = x->tavl_link[1];
+          x->tavl_link[1] = y;
+          x->tavl_balance = y->tavl_balance = 0;
+        }
+      else
+        {
+          assert (x->tavl_balance == +1);
+          w = x->tavl_link[1];
+          x->tavl_link[1] = w->tavl_link[0];
+          w->tavl_link[0] = x;
+          y->tavl_link[0] = w->tavl_link[1];
+          w->tavl_link[1] = y;
+          if (w->tavl_balance == -1)
+            x->tavl_balance = 0, y->tavl_balance = +1;
+          else if (w->tavl_balance == 0)
+            x->tavl_balance = y->tavl_balance = 0;
+          else /* |w->tavl_balance == +1| */
+            x->tavl_balance = -1, y->tavl_balance = 0;
+          w->tavl_balance = 0;
+          if (w->tavl_tag[0] == TAVL_THREAD)
+            {
+              x->tavl_tag[1] = TAVL_THREAD;
+              x->tavl_link[1] = w;
+              w->tavl_tag[0] = TAVL_CHILD;
+            }
+          if (w->tavl_tag[1] == TAVL_THREAD)
+            {
+              y->tavl_tag[0] = TAVL_THREAD;
+              y->tavl_link[0] = w;
+              w->tavl_tag[1] = TAVL_CHILD;
+            }
+        }
+    }
+  else if (y->tavl_balance == +2)
+    {
+      struct tavl_node *x = y->tavl_link[1];
+      if (x->tavl_balance == +1)
+        {
+          w = x;
+          if (x->tavl_tag[0] == TAVL_THREAD)
+            {
+              x->tavl_tag[0] = TAVL_CHILD;
+              y->tavl_tag[1] = TAVL_THREAD;
+              y->tavl_link[1] = x;
+            }
+          else
+            y->tavl_link[1] = x->tavl_link[0];
+          x->tavl_link[0] = y;
+          x->tavl_balance = y->tavl_balance = 0;
+        }
+      else
+        {
+          assert (x->tavl_balance == -1);
+          w = x->tavl_link[0];
+          x->tavl_link[0] = w->tavl_link[1];
+          w->tavl_link[1] = x;
+          y->tavl_link[1] = w->tavl_link[0];
+          w->tavl_link[0] = y;
+          if (w->tavl_balance == +1)
+            x->tavl_balance = 0, y->tavl_balance = -1;
+          else if (w->tavl_balance == 0)
+            x->tavl_balance = y->tavl_balance = 0;
+          else /* |w->tavl_balance == -1| */
+            x->tavl_balance = +1, y->tavl_balance = 0;
+          w->tavl_balance = 0;
+          if (w->tavl_tag[0] == TAVL_THREAD)
+            {
+              y->tavl_tag[1] = TAVL_THREAD;
+              y->tavl_link[1] = w;
+              w->tavl_tag[0] = TAVL_CHILD;
+            }
+          if (w->tavl_tag[1] == TAVL_THREAD)
+            {
+              x->tavl_tag[0] = TAVL_THREAD;
+              x->tavl_link[0] = w;
+              w->tavl_tag[1] = TAVL_CHILD;
+            }
+        }
+    }
+  else
+    return &n->tavl_data;
+
+  z->tavl_link[y != z->tavl_link[0]] = w;
+  return &n->tavl_data;
+}
+
+/* Returns the parent of |node| within |tree|,
+   or a pointer to |tavl_root| if |s| is the root of the tree. */
+static struct tavl_node *
+find_parent (struct tavl_table *tree, struct tavl_node *node)
+{
+  if (node != tree->tavl_root)
+    {
+      struct tavl_node *x, *y;
+
+      for (x = y = node; ; x = x->tavl_link[0], y = y->tavl_link[1])
+        if (y->tavl_tag[1] == TAVL_THREAD)
+          {
+            struct tavl_node *p = y->tavl_link[1];
+            if (p == NULL || p->tavl_link[0] != node)
+              {
+                while (x->tavl_tag[0] == TAVL_CHILD)
+                  x = x->tavl_link[0];
+                p = x->tavl_link[0];
+              }
+            return p;
+          }
+        else if (x->tavl_tag[0] == TAVL_THREAD)
+          {
+            struct tavl_node *p = x->tavl_link[0];
+            if (p == NULL || p->tavl_link[1] != node)
+              {
+                while (y->tavl_tag[1] == TAVL_CHILD)
+                  y = y->tavl_link[1];
+                p = y->tavl_link[1];
+              }
+            return p;
+          }
+    }
+  else
+    return (struct tavl_node *) &tree->tavl_root;
+}
+
+/* Deletes from |tree| and returns an item matching |item|.
+   Returns a null pointer if no matching item found. */
+void *
+tavl_delete (struct tavl_table *tree, const void *item)
+{
+  struct tavl_node *p; /* Traverses tree to find node to delete. */
+  struct tavl_node *q; /* Parent of |p|. */
+  int dir;             /* Index into |q->tavl_link[]| to get |p|. */
+  int cmp;             /* Result of comparison between |item| and |p|. */
+
+  assert (tree != NULL && item != NULL);
+
+  if (tree->tavl_root == NULL)
+    return NULL;
+
+  q = (struct tavl_node *) &tree->tavl_root;
+  p = tree->tavl_root;
+  dir = 0;
+  for (;;)
+    {
+      cmp = tree->tavl_compare (item, p->tavl_data, tree->tavl_param);
+      if (cmp == 0)
+        break;
+
+      dir = cmp > 0;
+      q = p;
+      if (p->tavl_tag[dir] == TAVL_THREAD)
+        return NULL;
+      p = p->tavl_link[dir];
+    }
+  item = p->tavl_data;
+
+  if (p->tavl_tag[1] == TAVL_THREAD)
+    {
+      if (p->tavl_tag[0] == TAVL_CHILD)
+        {
+          struct tavl_node *t = p->tavl_link[0];
+          while (t->tavl_tag[1] == TAVL_CHILD)
+            t = t->tavl_link[1];
+          t->tavl_link[1] = p->tavl_link[1];
+          q->tavl_link[dir] = p->tavl_link[0];
+        }
+      else
+        {
+          q->tavl_link[dir] = p->tavl_link[dir];
+          if (q != (struct tavl_node *) &tree->tavl_root)
+            q->tavl_tag[dir] = TAVL_THREAD;
+        }
+    }
+  else
+    {
+      struct tavl_node *r = p->tavl_link[1];
+      if (r->tavl_tag[0] == TAVL_THREAD)
+        {
+          r->tavl_link[0] = p->tavl_link[0];
+          r->tavl_tag[0] = p->tavl_tag[0];
+          if (r->tavl_tag[0] == TAVL_CHILD)
+            {
+              struct tavl_node *t = r->tavl_link[0];
+              while (t->tavl_tag[1] == TAVL_CHILD)
+                t = t->tavl_link[1];
+              t->tavl_link[1] = r;
+            }
+          q->tavl_link[dir] = r;
+          r->tavl_balance = p->tavl_balance;
+          q = r;
+          dir = 1;
+        }
+      else
+        {
+          struct tavl_node *s;
+
+          for (;;)
+            {
+              s = r->tavl_link[0];
+              if (s->tavl_tag[0] == TAVL_THREAD)
+                break;
+
+              r = s;
+            }
+
+          if (s->tavl_tag[1] == TAVL_CHILD)
+            r->tavl_link[0] = s->tavl_link[1];
+          else
+            {
+              r->tavl_link[0] = s;
+              r->tavl_tag[0] = TAVL_THREAD;
+            }
+
+          s->tavl_link[0] = p->tavl_link[0];
+          if (p->tavl_tag[0] == TAVL_CHILD)
+            {
+              struct tavl_node *t = p->tavl_link[0];
+              while (t->tavl_tag[1] == TAVL_CHILD)
+                t = t->tavl_link[1];
+              t->tavl_link[1] = s;
+
+              s->tavl_tag[0] = TAVL_CHILD;
+            }
+
+          s->tavl_link[1] = p->tavl_link[1];
+          s->tavl_tag[1] = TAVL_CHILD;
+
+          q->tavl_link[dir] = s;
+          s->tavl_balance = p->tavl_balance;
+          q = r;
+          dir = 0;
+        }
+    }
+
+  tree->tavl_alloc->libavl_free (tree->tavl_alloc, p);
+
+  while (q != (struct tavl_node *) &tree->tavl_root)
+    {
+      struct tavl_node *y = q;
+
+      q = find_parent (tree, y);
+
+      if (dir == 0)
+        {
+          dir = q->tavl_link[0] != y;
+          y->tavl_balance++;
+          if (y->tavl_balance == +1)
+            break;
+          else if (y->tavl_balance == +2)
+            {
+              struct tavl_node *x = y->tavl_link[1];
+
+              assert (x != NULL);
+              if (x->tavl_balance == -1)
+                {
+                  struct tavl_node *w;
+
+                  w = x->tavl_link[0];
+                  x->tavl_link[0] = w->tavl_link[1];
+                  w->tavl_link[1] = x;
+                  y->tavl_link[1] = w->tavl_link[0];
+                  w->tavl_link[0] = y;
+                  if (w->tavl_balance == +1)
+                    x->tavl_balance = 0, y->tavl_balance = -1;
+                  else if (w->tavl_balance == 0)
+                    x->tavl_balance = y->tavl_balance = 0;
+                  else /* |w->tavl_balance == -1| */
+                    x->tavl_balance = +1, y->tavl_balance = 0;
+                  w->tavl_balance = 0;
+                  if (w->tavl_tag[0] == TAVL_THREAD)
+                    {
+                      y->tavl_tag[1] = TAVL_THREAD;
+                      y->tavl_link[1] = w;
+                      w->tavl_tag[0] = TAVL_CHILD;
+                    }
+                  if (w->tavl_tag[1] == TAVL_THREAD)
+                    {
+                      x->tavl_tag[0] = TAVL_THREAD;
+                      x->tavl_link[0] = w;
+                      w->tavl_tag[1] = TAVL_CHILD;
+                    }
+                  q->tavl_link[dir] = w;
+                }
+              else
+                {
+                  q->tavl_link[dir] = x;
+
+                  if (x->tavl_balance == 0)
+                    {
+                      y->tavl_link[1] = x->tavl_link[0];
+                      x->tavl_link[0] = y;
+                      x->tavl_balance = -1;
+                      y->tavl_balance = +1;
+                      break;
+                    }
+                  else /* |x->tavl_balance == +1| */
+                    {
+                      if (x->tavl_tag[0] == TAVL_CHILD)
+                        y->tavl_link[1] = x->tavl_link[0];
+                      else
+                        {
+                          y->tavl_tag[1] = TAVL_THREAD;
+                          x->tavl_tag[0] = TAVL_CHILD;
+                        }
+                      x->tavl_link[0] = y;
+                      y->tavl_balance = x->tavl_balance = 0;
+                    }
+                }
+            }
+        }
+      else
+        {
+          dir = q->tavl_link[0] != y;
+          y->tavl_balance--;
+          if (y->tavl_balance == -1)
+            break;
+          else if (y->tavl_balance == -2)
+            {
+              struct tavl_node *x = y->tavl_link[0];
+
+              assert (x != NULL);
+              if (x->tavl_balance == +1)
+                {
+                  struct tavl_node *w;
+
+                  w = x->tavl_link[1];
+                  x->tavl_link[1] = w->tavl_link[0];
+                  w->tavl_link[0] = x;
+                  y->tavl_link[0] = w->tavl_link[1];
+                  w->tavl_link[1] = y;
+                  if (w->tavl_balance == -1)
+                    x->tavl_balance = 0, y->tavl_balance = +1;
+                  else if (w->tavl_balance == 0)
+                    x->tavl_balance = y->tavl_balance = 0;
+                  else /* |w->tavl_balance == +1| */
+                    x->tavl_balance = -1, y->tavl_balance = 0;
+                  w->tavl_balance = 0;
+                  if (w->tavl_tag[0] == TAVL_THREAD)
+                    {
+                      x->tavl_tag[1] = TAVL_THREAD;
+                      x->tavl_link[1] = w;
+                      w->tavl_tag[0] = TAVL_CHILD;
+                    }
+                  if (w->tavl_tag[1] == TAVL_THREAD)
+                    {
+                      y->tavl_tag[0] = TAVL_THREAD;
+                      y->tavl_link[0] = w;
+                      w->tavl_tag[1] = TAVL_CHILD;
+                    }
+                  q->tavl_link[dir] = w;
+                }
+              else
+                {
+                  q->tavl_link[dir] = x;
+
+                  if (x->tavl_balance == 0)
+                    {
+                      y->tavl_link[0] = x->tavl_link[1];
+                      x->tavl_link[1] = y;
+                      x->tavl_balance = +1;
+                      y->tavl_balance = -1;
+                      break;
+                    }
+                  else /* |x->tavl_balance == -1| */
+                    {
+                      if (x->tavl_tag[1] == TAVL_CHILD)
+                        y->tavl_link[0] = x->tavl_link[1];
+                      else
+                        {
+                          y->tavl_tag[0] = TAVL_THREAD;
+                          x->tavl_tag[1] = TAVL_CHILD;
+                        }
+                      x->tavl_link[1] = y;
+                      y->tavl_balance = x->tavl_balance = 0;
+                    }
+                }
+            }
+        }
+    }
+
+  tree->tavl_count--;
+  return (void *) item;
+}
+
+/* Initializes |trav| for use with |tree|
+   and selects the null node. */
+void
+tavl_t_init (struct tavl_traverser *trav, struct tavl_table *tree)
+{
+  trav->tavl_table = tree;
+  trav->tavl_node = NULL;
+}
+
+/* Initializes |trav| for |tree|.
+   Returns data item in |tree| with the least value,
+   or |NULL| if |tree| is empty. */
+void *
+tavl_t_first (struct tavl_traverser *trav, struct tavl_table *tree)
+{
+  assert (tree != NULL && trav != NULL);
+
+  trav->tavl_table = tree;
+  trav->tavl_node = tree->tavl_root;
+  if (trav->tavl_node != NULL)
+    {
+      while (trav->tavl_node->tavl_tag[0] == TAVL_CHILD)
+        trav->tavl_node = trav->tavl_node->tavl_link[0];
+      return trav->tavl_node->tavl_data;
+    }
+  else
+    return NULL;
+}
+
+/* Initializes |trav| for |tree|.
+   Returns data item in |tree| with the greatest value,
+   or |NULL| if |tree| is empty. */
+void *
+tavl_t_last (struct tavl_traverser *trav, struct tavl_table *tree)
+{
+  assert (tree != NULL && trav != NULL);
+
+  trav->tavl_table = tree;
+  trav->tavl_node = tree->tavl_root;
+  if (trav->tavl_node != NULL)
+    {
+      while (trav->tavl_node->tavl_tag[1] == TAVL_CHILD)
+        trav->tavl_node = trav->tavl_node->tavl_link[1];
+      return trav->tavl_node->tavl_data;
+    }
+  else
+    return NULL;
+}
+
+/* Searches for |item| in |tree|.
+   If found, initializes |trav| to the item found and returns the item
+   as well.
+   If there is no matching item, initializes |trav| to the null item
+   and returns |NULL|. */
+void *
+tavl_t_find (struct tavl_traverser *trav, struct tavl_table *tree, void *item)
+{
+  struct tavl_node *p;
+
+  assert (trav != NULL && tree != NULL && item != NULL);
+
+  trav->tavl_table = tree;
+  trav->tavl_node = NULL;
+
+  p = tree->tavl_root;
+  if (p == NULL)
+    return NULL;
+
+  for (;;)
+    {
+      int cmp, dir;
+
+      cmp = tree->tavl_compare (item, p->tavl_data, tree->tavl_param);
+      if (cmp == 0)
+        {
+          trav->tavl_node = p;
+          return p->tavl_data;
+        }
+
+      dir = cmp > 0;
+      if (p->tavl_tag[dir] == TAVL_CHILD)
+        p = p->tavl_link[dir];
+      else
+        return NULL;
+    }
+}
+
+/* Returns the next data item in inorder
+   within the tree being traversed with |trav|,
+   or if there are no more data items returns |NULL|. */
+void *
+tavl_t_next (struct tavl_traverser *trav)
+{
+  assert (trav != NULL);
+
+  if (trav->tavl_node == NULL)
+    return tavl_t_first (trav, trav->tavl_table);
+  else if (trav->tavl_node->tavl_tag[1] == TAVL_THREAD)
+    {
+      trav->tavl_node = trav->tavl_node->tavl_link[1];
+      return trav->tavl_node != NULL ? trav->tavl_node->tavl_data : NULL;
+    }
+  else
+    {
+      trav->tavl_node = trav->tavl_node->tavl_link[1];
+      while (trav->tavl_node->tavl_tag[0] == TAVL_CHILD)
+        trav->tavl_node = trav->tavl_node->tavl_link[0];
+      return trav->tavl_node->tavl_data;
+    }
+}
+
+/* Returns the previous data item in inorder
+   within the tree being traversed with |trav|,
+   or if there are no more data items returns |NULL|. */
+void *
+tavl_t_prev (struct tavl_traverser *trav)
+{
+  assert (trav != NULL);
+
+  if (trav->tavl_node == NULL)
+    return tavl_t_last (trav, trav->tavl_table);
+  else if (trav->tavl_node->tavl_tag[0] == TAVL_THREAD)
+    {
+      trav->tavl_node = trav->tavl_node->tavl_link[0];
+      return trav->tavl_node != NULL ? trav->tavl_node->tavl_data : NULL;
+    }
+  else
+    {
+      trav->tavl_node = trav->tavl_node->tavl_link[0];
+      while (trav->tavl_node->tavl_tag[1] == TAVL_CHILD)
+        trav->tavl_node = trav->tavl_node->tavl_link[1];
+      return trav->tavl_node->tavl_data;
+    }
+}
+
+/* Returns |trav|'s current item. */
+void *
+tavl_t_cur (struct tavl_traverser *trav)
+{
+  assert (trav != NULL);
+
+  return trav->tavl_node != NULL ? trav->tavl_node->tavl_data : NULL;
+}
+
+/* Frees the nodes of a subtree rooted at |node|, without touching the
+   data items. */
+static void
+destroy_nodes (struct tavl_table *tree, struct tavl_node *node)
+{
+  while (node != NULL)
+    {
+      struct tavl_node *right;
+
+      right = node->tavl_tag[1] == TAVL_CHILD ? node->tavl_link[1] : NULL;
+      if (node->tavl_tag[0] == TAVL_CHILD)
+        destroy_nodes (tree, node->tavl_link[0]);
+      tree->tavl_alloc->libavl_free (tree->tavl_alloc, node);
+      node = right;
+    }
+}
+
+/* Builds a perfectly balanced subtree from the |count| items of |items|
+   and stores its height into |*height|.
+   The extreme nodes of the subtree are threaded to |pred| and |succ|,
+   the in-order neighbors of the whole subtree.
+   Returns the root of the subtree, or |NULL| if |count| is zero or if a
+   memory allocation error occurred, in which case |*height| is negative. */
+static struct tavl_node *
+build_balanced (struct tavl_table *tree, void **items, size_t count,
+                struct tavl_node *pred, struct tavl_node *succ, int *height)
+{
+  struct tavl_node *node;
+  size_t middle = count / 2;
+  int left_height, right_height;
+
+  if (count == 0)
+    {
+      *height = 0;
+      return NULL;
+    }
+
+  node = tree->tavl_alloc->libavl_malloc (tree->tavl_alloc, sizeof *node);
+  if (node == NULL)
+    {
+      *height = -1;
+      return NULL;
+    }
+
+  node->tavl_data = items[middle];
+  node->tavl_tag[0] = node->tavl_tag[1] = TAVL_THREAD;
+  node->tavl_link[0] = pred;
+  node->tavl_link[1] = succ;
+
+  if (middle > 0)
+    {
+      node->tavl_link[0] = build_balanced (tree, items, middle,
+                                           pred, node, &left_height);
+      if (left_height < 0)
+        {
+          tree->tavl_alloc->libavl_free (tree->tavl_alloc, node);
+          *height = -1;
+          return NULL;
+        }
+      node->tavl_tag[0] = TAVL_CHILD;
+    }
+  else
+    left_height = 0;
+
+  if (count - middle - 1 > 0)
+    {
+      node->tavl_link[1] = build_balanced (tree, items + middle + 1,
+                                           count - middle - 1,
+                                           node, succ, &right_height);
+      if (right_height < 0)
+        {
+          node->tavl_tag[1] = TAVL_THREAD;
+          destroy_nodes (tree, node);
+          *height = -1;
+          return NULL;
+        }
+      node->tavl_tag[1] = TAVL_CHILD;
+    }
+  else
+    right_height = 0;
+
+  /* The left subtree never holds fewer items than the right one,
+     so the balance factor is either 0 or -1. */
+  node->tavl_balance = right_height - left_height;
+  *height = (left_height > right_height ? left_height : right_height) + 1;
+  return node;
+}
+
+/* Fills |tree|, which must be empty, with the |count| items of |items|.
+   The items must be sorted in increasing order according to |tree|'s
+   comparison function and must not contain duplicates.
+   The resulting tree is perfectly balanced and is built in linear time.
+   Returns nonzero on success, zero if a memory allocation error occurred,
+   in which case |tree| is left empty. */
+int
+tavl_build (struct tavl_table *tree, void **items, size_t count)
+{
+  int height;
+
+  assert (tree != NULL && tree->tavl_root == NULL);
+  assert (count == 0 || items != NULL);
+
+  tree->tavl_root = build_balanced (tree, items, count, NULL, NULL, &height);
+  if (height < 0)
+    return 0;
+
+  tree->tavl_count = count;
+  return 1;
+}
+
+/* Frees storage allocated for |tree|.
+   If |destroy != NULL|, applies it to each data item in inorder. */
+void
+tavl_destroy (struct tavl_table *tree, tavl_item_func *destroy)
+{
+  struct tavl_node *p; /* Current node. */
+  struct tavl_node *n; /* Next node. */
+
+  assert (tree != NULL);
+
+  p = tree->tavl_root;
+  if (p != NULL)
+    while (p->tavl_tag[0] == TAVL_CHILD)
+      p = p->tavl_link[0];
+
+  while (p != NULL)
+    {
+      n = p->tavl_link[1];
+      if (p->tavl_tag[1] == TAVL_CHILD)
+        while (n->tavl_tag[0] == TAVL_CHILD)
+          n = n->tavl_link[0];
+
+      if (destroy != NULL && p->tavl_data != NULL)
+        destroy (p->tavl_data, tree->tavl_param);
+      tree->tavl_alloc->libavl_free (tree->tavl_alloc, p);
+
+      p = n;
+    }
+
+  tree->tavl_alloc->libavl_free (tree->tavl_alloc, tree);
+}
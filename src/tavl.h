@@ -0,0 +1,105 @@
+/* libavl - library for manipulation of binary trees.
+   Copyright (C) 1998-2002 Free Software Foundation, Inc.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of the
+   License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+   See the GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+   02111-1307, USA.
+
+   The author may be contacted at <blp@gnu.org> on the Internet, or
+   write to Ben Pfaff, Stanford University, Computer Science Dept., 353
+   Serra Mall, Stanford CA 94305, USA.
+*/
+
+#ifndef TAVL_H
+#define TAVL_H 1
+
+#include <stddef.h>
+
+/* The function types and the memory allocator are shared with the
+   plain AVL trees. */
+#include "avl.h"
+
+typedef avl_comparison_func tavl_comparison_func;
+typedef avl_item_func tavl_item_func;
+
+/* Maximum TAVL height.
+   An AVL tree of height h has at least F(h + 2) - 1 nodes, F being the
+   Fibonacci sequence with F(1) = F(2) = 1.  A height of 32 is thus
+   reachable with F(34) - 1 = 5702886 nodes, and a height of 49 needs
+   F(51) - 1 (about 2.0e10) nodes: 48 covers every tree of fewer than
+   2.0e10 nodes.  bench_table has been run up to 1e7 keys. */
+#ifndef TAVL_MAX_HEIGHT
+#define TAVL_MAX_HEIGHT 48
+#endif
+
+/* Tree data structure. */
+struct tavl_table
+  {
+    struct tavl_node *tavl_root;        /* Tree's root. */
+    tavl_comparison_func *tavl_compare; /* Comparison function. */
+    void *tavl_param;                   /* Extra argument to |tavl_compare|. */
+    struct libavl_allocator *tavl_alloc; /* Memory allocator. */
+    size_t tavl_count;                  /* Number of items in tree. */
+  };
+
+/* Characterizes a link as a child pointer or a thread. */
+enum tavl_tag
+  {
+    TAVL_CHILD,                     /* Child pointer. */
+    TAVL_THREAD                     /* Thread. */
+  };
+
+/* A threaded AVL tree node.
+   A link whose tag is |TAVL_THREAD| does not point to a child but to the
+   in-order predecessor (left link) or successor (right link) of the node,
+   or is null at both ends of the tree. */
+struct tavl_node
+  {
+    struct tavl_node *tavl_link[2]; /* Subtrees. */
+    void *tavl_data;                /* Pointer to data. */
+    unsigned char tavl_tag[2];      /* Tag fields. */
+    signed char tavl_balance;       /* Balance factor. */
+  };
+
+/* TAVL traverser structure.
+   Thanks to the threads, no stack is needed to move to the next or
+   previous node, and the traverser is never invalidated by insertions
+   into the tree. */
+struct tavl_traverser
+  {
+    struct tavl_table *tavl_table;  /* Tree being traversed. */
+    struct tavl_node *tavl_node;    /* Current node in tree. */
+  };
+
+/* Table functions. */
+struct tavl_table *tavl_create (tavl_comparison_func *, void *,
+                                struct libavl_allocator *);
+void tavl_destroy (struct tavl_table *, tavl_item_func *);
+void **tavl_probe (struct tavl_table *, void *);
+void *tavl_delete (struct tavl_table *, const void *);
+void *tavl_find (const struct tavl_table *, const void *);
+int tavl_build (struct tavl_table *, void **, size_t);
+
+#define tavl_count(table) ((size_t) (table)->tavl_count)
+
+/* Table traverser functions. */
+void tavl_t_init (struct tavl_traverser *, struct tavl_table *);
+void *tavl_t_first (struct tavl_traverser *, struct tavl_table *);
+void *tavl_t_last (struct tavl_traverser *, struct tavl_table *);
+void *tavl_t_find (struct tavl_traverser *, struct tavl_table *, void *);
+void *tavl_t_next (struct tavl_traverser *);
+void *tavl_t_prev (struct tavl_traverser *);
+void *tavl_t_cur (struct tavl_traverser *);
+
+#endif /* tavl.h */
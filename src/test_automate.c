@@ -101,9 +101,7 @@ int main(){
 
 	print_separation_tests();
 
-	automate_accessible(automate2);
-	
-	liberer_automate(automate2);
+	liberer_automate(automate_accessible(automate2));
 
 	Automate* suffixes = creer_automate_des_suffixes(automate2);
 	printf("\n\n\nAutomate des suffixes de Automate2\n");
@@ -124,6 +122,8 @@ int main(){
 	Automate* sousmot = creer_automate_des_sous_mots(automate2);
 	printf("\n\n\nAutomate des sous mots de Automate2\n");
 	print_automate(sousmot);
+
+	liberer_automate(automate2);
 	
 	print_separation_tests();
 	
@@ -21,6 +21,7 @@
 
 #include "automate.h"
 #include "outils.h"
+#include "conteneurs_types.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -171,6 +172,64 @@ int test_creer_ensemble(){
 	return result;
 }
 
+int test_creer_ensemble_depuis_tableau_trie(){
+	int result = 1;
+	int i;
+
+	intptr_t elements[1000];
+	for( i=0; i<1000; i++ ) elements[i] = 2*i - 7;
+
+	Ensemble * ens = creer_ensemble_depuis_tableau_trie(
+		NULL, NULL, NULL, elements, 1000
+	);
+
+	TEST( taille_ensemble( ens ) == 1000, result );
+	TEST( est_dans_l_ensemble( ens, -7 ), result );
+	TEST( est_dans_l_ensemble( ens, 1991 ), result );
+	TEST( ! est_dans_l_ensemble( ens, 0 ), result );
+	TEST( get_element( premier_iterateur_ensemble( ens ) ) == -7, result );
+
+	ajouter_element( ens, 0 );
+	retirer_element( ens, 1991 );
+	TEST( taille_ensemble( ens ) == 1000, result );
+	TEST( est_dans_l_ensemble( ens, 0 ), result );
+	TEST( ! est_dans_l_ensemble( ens, 1991 ), result );
+
+	liberer_ensemble( ens );
+
+	ens = creer_ensemble_depuis_tableau_trie( NULL, NULL, NULL, NULL, 0 );
+	TEST( taille_ensemble( ens ) == 0, result );
+	liberer_ensemble( ens );
+
+	Elmt elmts[3];
+	initialiser_elmt( &elmts[0], 1 );
+	initialiser_elmt( &elmts[1], 4 );
+	initialiser_elmt( &elmts[2], 9 );
+	intptr_t pointeurs[3] = { 
+		(intptr_t) &elmts[0], (intptr_t) &elmts[1], (intptr_t) &elmts[2] 
+	};
+
+	ens = creer_ensemble_depuis_tableau_trie(
+		(int (*)( const intptr_t, const intptr_t)) comparer_elmt, 
+		(intptr_t (*)( const intptr_t )) copier_elmt, 
+		(void (*)( intptr_t )) supprimer_elmt,
+		pointeurs, 3
+	);
+
+	Elmt elmt;
+	initialiser_elmt( &elmt, 4 );
+	TEST( est_dans_l_ensemble( ens, (intptr_t) &elmt ), result );
+	TEST( get_element( trouver_ensemble( ens, (intptr_t) &elmt ) ) != (intptr_t) &elmts[1], result );
+
+	Ensemble * copie = copier_ensemble( ens );
+	TEST( ensembles_egaux( ens, copie ), result );
+
+	liberer_ensemble( ens );
+	liberer_ensemble( copie );
+
+	return result;
+}
+
 int test_liberer_ensemble(){
 	int result = 1;
 
@@ -537,6 +596,155 @@ int test_comparer_ensemble(){
 	return result;
 }
 
+int test_ensembles_egaux(){
+	int result = 1;
+
+	Ensemble * ens1 = creer_ensemble( NULL, NULL, NULL );
+	Ensemble * ens2 = creer_ensemble( NULL, NULL, NULL );
+
+	TEST( ensembles_egaux( ens1, ens2 ), result );
+
+	ajouter_element( ens1, 2 );
+	ajouter_element( ens1, 1 );
+
+	TEST( ! ensembles_egaux( ens1, ens2 ), result );
+
+	ajouter_element( ens2, 1 );
+	ajouter_element( ens2, 3 );
+
+	TEST( ! ensembles_egaux( ens1, ens2 ), result );
+
+	retirer_element( ens2, 3 );
+	ajouter_element( ens2, 2 );
+
+	TEST( ensembles_egaux( ens1, ens2 ), result );
+
+	liberer_ensemble( ens1 );
+	liberer_ensemble( ens2 );
+
+	return result;
+}
+
+int test_creer_intersection_ensemble(){
+	int result = 1;
+
+	Ensemble * ens1 = creer_ensemble( NULL, NULL, NULL );
+	Ensemble * ens2 = creer_ensemble( NULL, NULL, NULL );
+
+	ajouter_element( ens1, 1 );
+	ajouter_element( ens1, 2 );
+	ajouter_element( ens1, 5 );
+	ajouter_element( ens1, 8 );
+
+	ajouter_element( ens2, 2 );
+	ajouter_element( ens2, 8 );
+	ajouter_element( ens2, 9 );
+
+	Ensemble * inter = creer_intersection_ensemble( ens1, ens2 );
+	TEST( taille_ensemble( inter ) == 2, result );
+	TEST( est_dans_l_ensemble( inter, 2 ), result );
+	TEST( est_dans_l_ensemble( inter, 8 ), result );
+	liberer_ensemble( inter );
+
+	inter = creer_intersection_ensemble( ens2, ens1 );
+	TEST( taille_ensemble( inter ) == 2, result );
+	TEST( est_dans_l_ensemble( inter, 2 ), result );
+	TEST( est_dans_l_ensemble( inter, 8 ), result );
+	liberer_ensemble( inter );
+
+	int i;
+	for( i=10; i<1000; i++ ) ajouter_element( ens2, i );
+	inter = creer_intersection_ensemble( ens1, ens2 );
+	TEST( taille_ensemble( inter ) == 2, result );
+	TEST( est_dans_l_ensemble( inter, 2 ), result );
+	TEST( est_dans_l_ensemble( inter, 8 ), result );
+	liberer_ensemble( inter );
+	for( i=10; i<1000; i++ ) retirer_element( ens2, i );
+
+	Ensemble * uni = creer_union_ensemble( ens2, ens1 );
+	TEST( taille_ensemble( uni ) == 5, result );
+	liberer_ensemble( uni );
+
+	Ensemble * diff = creer_difference_ensemble( ens1, ens2 );
+	TEST( taille_ensemble( diff ) == 2, result );
+	TEST( est_dans_l_ensemble( diff, 1 ), result );
+	TEST( est_dans_l_ensemble( diff, 5 ), result );
+	liberer_ensemble( diff );
+
+	liberer_ensemble( ens1 );
+	liberer_ensemble( ens2 );
+
+	return result;
+}
+
+int test_union_dans(){
+	int result = 1;
+	int i;
+
+	Ensemble * ens1 = creer_ensemble( NULL, NULL, NULL );
+	Ensemble * ens2 = creer_ensemble( NULL, NULL, NULL );
+
+	for( i=0; i<100; i+=2 ) ajouter_element( ens1, i );
+	for( i=0; i<100; i+=3 ) ajouter_element( ens2, i );
+
+	union_dans( ens1, ens2 );
+
+	TEST( taille_ensemble( ens1 ) == 67, result );
+	for( i=0; i<100; i++ ){
+		TEST( 
+			est_dans_l_ensemble( ens1, i ) == ( i%2 == 0 || i%3 == 0 ), result
+		);
+	}
+
+	intersection_dans( ens1, ens2 );
+
+	TEST( ensembles_egaux( ens1, ens2 ), result );
+
+	vider_ensemble( ens2 );
+	intersection_dans( ens1, ens2 );
+
+	TEST( taille_ensemble( ens1 ) == 0, result );
+
+	liberer_ensemble( ens1 );
+	liberer_ensemble( ens2 );
+
+
+	ens1 = creer_ensemble(
+		(int (*)( const intptr_t, const intptr_t)) comparer_elmt, 
+		(intptr_t (*)( const intptr_t )) copier_elmt, 
+		(void (*)( intptr_t )) supprimer_elmt
+	);
+	ens2 = creer_ensemble(
+		(int (*)( const intptr_t, const intptr_t)) comparer_elmt, 
+		(intptr_t (*)( const intptr_t )) copier_elmt, 
+		(void (*)( intptr_t )) supprimer_elmt
+	);
+
+	Elmt elmt;
+	for( i=0; i<10; i++ ){
+		initialiser_elmt( &elmt, i );
+		ajouter_element( ( i<6 ) ? ens1 : ens2, (intptr_t) &elmt );
+		if( i == 3 ) ajouter_element( ens2, (intptr_t) &elmt );
+	}
+
+	union_dans( ens1, ens2 );
+
+	TEST( taille_ensemble( ens1 ) == 10, result );
+
+	intersection_dans( ens1, ens2 );
+
+	TEST( taille_ensemble( ens1 ) == 5, result );
+	initialiser_elmt( &elmt, 3 );
+	TEST( est_dans_l_ensemble( ens1, (intptr_t) &elmt ), result );
+	initialiser_elmt( &elmt, 4 );
+	TEST( ! est_dans_l_ensemble( ens1, (intptr_t) &elmt ), result );
+
+	liberer_ensemble( ens1 );
+	liberer_ensemble( ens2 );
+
+	return result;
+}
+
 int test_copier_ensemble(){
 	int result = 1;
 
@@ -718,6 +926,98 @@ int test_swap_ensemble(){
 	return result;
 }
 
+int test_hacher_ensemble(){
+	int result = 1;
+
+	Ensemble * ens1 = creer_ensemble( NULL, NULL, NULL );
+	Ensemble * ens2 = creer_ensemble_arbre_b( NULL, NULL, NULL );
+
+	TEST( hacher_ensemble( ens1 ) == hacher_ensemble( ens2 ), result );
+
+	ajouter_element( ens1, 3 );
+	ajouter_element( ens1, 1 );
+	ajouter_element( ens1, 7 );
+	ajouter_element( ens1, 1 );
+
+	ajouter_element( ens2, 7 );
+	ajouter_element( ens2, 8 );
+	ajouter_element( ens2, 1 );
+	ajouter_element( ens2, 3 );
+	retirer_element( ens2, 8 );
+	retirer_element( ens2, 5 );
+
+	TEST( hacher_ensemble( ens1 ) == hacher_ensemble( ens2 ), result );
+
+	ajouter_element( ens2, 2 );
+	TEST( hacher_ensemble( ens1 ) != hacher_ensemble( ens2 ), result );
+
+	// Après une union, la valeur est recalculée.
+	Ensemble * ens3 = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( ens3, 2 );
+	union_dans( ens1, ens3 );
+	TEST( hacher_ensemble( ens1 ) == hacher_ensemble( ens2 ), result );
+	actualiser_hachage_ensemble( ens1 );
+	TEST( hacher_ensemble( ens1 ) == hacher_ensemble( ens2 ), result );
+
+	Ensemble * copie = copier_ensemble( ens1 );
+	TEST( hacher_ensemble( copie ) == hacher_ensemble( ens2 ), result );
+
+	vider_ensemble( ens3 );
+	vider_ensemble( copie );
+	TEST( hacher_ensemble( copie ) == hacher_ensemble( ens3 ), result );
+
+	liberer_ensemble( copie );
+	liberer_ensemble( ens3 );
+	liberer_ensemble( ens1 );
+	liberer_ensemble( ens2 );
+
+	return result;
+}
+
+int test_catalogue_ensembles(){
+	int result = 1;
+
+	Catalogue_ensembles * catalogue = creer_catalogue_ensembles();
+
+	Ensemble * ens = creer_ensemble( NULL, NULL, NULL );
+	int nouveau;
+	size_t vide = numero_ensemble( catalogue, ens, &nouveau );
+	TEST( vide == 0 && nouveau, result );
+
+	ajouter_element( ens, 4 );
+	ajouter_element( ens, 2 );
+	size_t deux_quatre = numero_ensemble( catalogue, ens, &nouveau );
+	TEST( deux_quatre == 1 && nouveau, result );
+
+	// L'ensemble rangé est une copie : modifier 'ens' ne le change pas.
+	ajouter_element( ens, 5 );
+	size_t numero;
+	TEST( ! chercher_numero_ensemble( catalogue, ens, &numero ), result );
+	TEST( numero_ensemble( catalogue, ens, NULL ) == 2, result );
+
+	Ensemble * autre = creer_ensemble_arbre_b( NULL, NULL, NULL );
+	ajouter_element( autre, 2 );
+	ajouter_element( autre, 4 );
+	TEST( numero_ensemble( catalogue, autre, &nouveau ) == deux_quatre, result );
+	TEST( ! nouveau, result );
+	TEST( 
+		chercher_numero_ensemble( catalogue, autre, &numero ) 
+		&& numero == deux_quatre, 
+		result 
+	);
+
+	TEST( taille_catalogue_ensembles( catalogue ) == 3, result );
+	TEST( taille_ensemble( ensemble_du_numero( catalogue, vide ) ) == 0, result );
+	TEST( ensembles_egaux( ensemble_du_numero( catalogue, deux_quatre ), autre ), result );
+	TEST( ensembles_egaux( ensemble_du_numero( catalogue, 2 ), ens ), result );
+
+	liberer_ensemble( autre );
+	liberer_ensemble( ens );
+	liberer_catalogue_ensembles( catalogue );
+
+	return result;
+}
+
 int test_trouver_ensemble(){
 	int result = 1;
 
@@ -937,12 +1237,174 @@ int test_get_element(){
 	return result;
 }
 
+int test_curseur_ensemble(){
+	int result = 1;
+
+	Ensemble * ens = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( ens, 3 );
+	ajouter_element( ens, 1 );
+	ajouter_element( ens, 2 );
+
+	Ensemble_curseur c;
+	intptr_t attendu = 1;
+	int ok = 1;
+	for(
+		placer_curseur_ensemble( &c, ens );
+		! curseur_ensemble_est_vide( &c );
+		avancer_curseur_ensemble( &c )
+	){
+		if( element_du_curseur( &c ) != attendu ) ok = 0;
+		attendu++;
+	}
+	TEST( ok && attendu == 4, result );
+
+	vider_ensemble( ens );
+	placer_curseur_ensemble( &c, ens );
+	TEST( curseur_ensemble_est_vide( &c ), result );
+
+	liberer_ensemble( ens );
+	return result;
+}
+
+int test_creer_ensemble_arbre_b(){
+	int result = 1;
+	int i;
+
+	Ensemble * ens = creer_ensemble_arbre_b( NULL, NULL, NULL );
+	Ensemble * pairs = creer_ensemble( NULL, NULL, NULL );
+	for( i=999; i>=0; i-- ){
+		ajouter_element( ens, i );
+	}
+	for( i=0; i<1000; i+=2 ){
+		ajouter_element( pairs, i );
+	}
+	TEST( taille_ensemble( ens ) == 1000, result );
+	TEST( est_dans_l_ensemble( ens, 500 ), result );
+	TEST( ! est_dans_l_ensemble( ens, 1000 ), result );
+
+	for( i=1; i<1000; i+=2 ){
+		retirer_element( ens, i );
+	}
+	TEST( ensembles_egaux( ens, pairs ), result );
+
+	Ensemble * inter = creer_intersection_ensemble( ens, pairs );
+	TEST( ensembles_egaux( inter, pairs ), result );
+	liberer_ensemble( inter );
+
+	Ensemble_curseur c;
+	intptr_t attendu = 0;
+	int ok = 1;
+	for(
+		placer_curseur_ensemble( &c, ens );
+		! curseur_ensemble_est_vide( &c );
+		avancer_curseur_ensemble( &c )
+	){
+		if( element_du_curseur( &c ) != attendu ) ok = 0;
+		attendu += 2;
+	}
+	TEST( ok && attendu == 1000, result );
+
+	liberer_ensemble( pairs );
+	liberer_ensemble( ens );
+	return result;
+}
+
+int test_premier_iterateur_superieur_ensemble(){
+	int result = 1;
+
+	Ensemble * ens = creer_ensemble( NULL, NULL, NULL );
+	TEST( iterateur_ensemble_est_vide( premier_iterateur_superieur_ou_egal_ensemble( ens, 0 ) ), result );
+	ajouter_element( ens, 10 );
+	ajouter_element( ens, 20 );
+	ajouter_element( ens, 30 );
+
+	TEST( get_element( premier_iterateur_superieur_ou_egal_ensemble( ens, 5 ) ) == 10, result );
+	TEST( get_element( premier_iterateur_superieur_ou_egal_ensemble( ens, 20 ) ) == 20, result );
+	TEST( get_element( premier_iterateur_superieur_ensemble( ens, 20 ) ) == 30, result );
+	TEST( iterateur_ensemble_est_vide( premier_iterateur_superieur_ou_egal_ensemble( ens, 31 ) ), result );
+	TEST( iterateur_ensemble_est_vide( premier_iterateur_superieur_ensemble( ens, 30 ) ), result );
+
+	liberer_ensemble( ens );
+	return result;
+}
+
+DEFINIR_ENSEMBLE( Ensemble_entiers, int, COMPARER_VALEURS )
+DEFINIR_TABLE( Table_lettres, char, int, COMPARER_VALEURS )
+
+int test_conteneurs_types(){
+	int result = 1;
+	int i;
+
+	Ensemble_entiers ens;
+	Ensemble_entiers_initialiser( &ens );
+	TEST( ens.nb == 0, result );
+	TEST( ! Ensemble_entiers_contient( &ens, 0 ), result );
+	for( i=0; i<100; i++ ){
+		Ensemble_entiers_ajouter( &ens, ( i * 37 ) % 100 );
+	}
+	int ajoute = Ensemble_entiers_ajouter( &ens, 42 );
+	TEST( ! ajoute, result );
+	TEST( ens.nb == 100, result );
+	int ok = 1;
+	for( i=0; i<100; i++ ){
+		if( ens.elements[i] != i ) ok = 0;
+	}
+	TEST( ok, result );
+	for( i=0; i<100; i+=2 ){
+		Ensemble_entiers_retirer( &ens, i );
+	}
+	int retire = Ensemble_entiers_retirer( &ens, 0 );
+	TEST( ! retire, result );
+	TEST( ens.nb == 50, result );
+	TEST( Ensemble_entiers_contient( &ens, 51 ), result );
+	TEST( ! Ensemble_entiers_contient( &ens, 50 ), result );
+	TEST( Ensemble_entiers_position( &ens, 50 ) == 25, result );
+	Ensemble_entiers_liberer( &ens );
+	TEST( ens.nb == 0, result );
+
+	// Remplissage dans le désordre, avec doublons, puis normalisation.
+	for( i=0; i<300; i++ ){
+		Ensemble_entiers_empiler( &ens, ( i * 37 ) % 100 );
+	}
+	TEST( ens.nb == 300, result );
+	Ensemble_entiers_normaliser( &ens );
+	TEST( ens.nb == 100, result );
+	ok = 1;
+	for( i=0; i<100; i++ ){
+		if( ens.elements[i] != i ) ok = 0;
+	}
+	TEST( ok, result );
+	Ensemble_entiers_liberer( &ens );
+
+	Table_lettres table;
+	Table_lettres_initialiser( &table );
+	const char * mot = "abracadabra";
+	int nouvelle;
+	for( i=0; mot[i]; i++ ){
+		int * nb = Table_lettres_trouver_ou_ajouter( &table, mot[i], &nouvelle );
+		if( nouvelle ) *nb = 0;
+		(*nb)++;
+	}
+	TEST( table.nb == 5, result );
+	TEST( table.cles[0] == 'a' && table.valeurs[0] == 5, result );
+	TEST( *Table_lettres_trouver( &table, 'r' ) == 2, result );
+	TEST( Table_lettres_trouver( &table, 'z' ) == NULL, result );
+	retire = Table_lettres_retirer( &table, 'b' );
+	TEST( retire, result );
+	TEST( Table_lettres_trouver( &table, 'b' ) == NULL, result );
+	TEST( table.nb == 4 && table.cles[1] == 'c', result );
+	Table_lettres_liberer( &table );
+
+	return result;
+}
+
 
 int main(){
 	int result = 1;
 
 	result &= general_tests();
 	result &= test_creer_ensemble();
+	result &= test_creer_ensemble_depuis_tableau_trie();
 	result &= test_liberer_ensemble();
 	result &= test_ajouter_element();
 	result &= test_ajouter_elements();
@@ -952,6 +1414,11 @@ int main(){
 	result &= test_est_dans_l_ensemble();
 	result &= test_taille_ensemble();
 	result &= test_comparer_ensemble();
+	result &= test_ensembles_egaux();
+	result &= test_hacher_ensemble();
+	result &= test_catalogue_ensembles();
+	result &= test_creer_intersection_ensemble();
+	result &= test_union_dans();
 	result &= test_copier_ensemble();
 	result &= test_pour_tout_element();
 	result &= test_print_ensemble();
@@ -962,6 +1429,10 @@ int main(){
 	result &= test_iterateur_precedent_ensemble();
 	result &= test_iterateur_ensemble_est_vide();
 	result &= test_get_element();
+	result &= test_curseur_ensemble();
+	result &= test_creer_ensemble_arbre_b();
+	result &= test_premier_iterateur_superieur_ensemble();
+	result &= test_conteneurs_types();
 
 	if( ! result ){
 		fprintf( stderr, "Certains tests du fichier %s ont échoués.\n", __FILE__ );
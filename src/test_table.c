@@ -81,6 +81,10 @@ Cle * copier_cle( const Cle * cle ) {
 	return creer_cle( cle->cle );
 };
 
+unsigned long hacher_cle( const Cle * cle ){
+	return (unsigned long) cle->cle;
+}
+
 
 int general_test(){
 	int result = 1;
@@ -284,6 +288,688 @@ int test_vider_table(){
 	return result;
 }
 
+int test_taille_table(){
+	int result = 1;
+
+	Table * table = creer_table( NULL, NULL, NULL );
+
+	TEST( taille_table( table ) == 0, result );
+
+	add_table( table, 1, 11 );
+	add_table( table, 1, 21 );
+	add_table( table, 5, 12 );
+	add_table( table, 2, 12 );
+
+	TEST( taille_table( table ) == 3, result );
+
+	delete_table( table, 2 );
+
+	TEST( taille_table( table ) == 2, result );
+
+	vider_table( table );
+
+	TEST( taille_table( table ) == 0, result );
+
+	liberer_table( table );
+
+	return result;
+}
+
+int test_creer_union_table(){
+	int result = 1;
+
+	Table * table1 = creer_table( NULL, NULL, NULL );
+	Table * table2 = creer_table( NULL, NULL, NULL );
+
+	add_table( table1, 1, 11 );
+	add_table( table1, 3, 13 );
+	add_table( table1, 5, 15 );
+	add_table( table2, 3, 23 );
+	add_table( table2, 4, 24 );
+
+	Table * table = creer_union_table( table1, table2 );
+	TEST( taille_table( table ) == 4, result );
+	TEST( get_valeur( trouver_table( table, 3 ) ) == 13, result );
+	TEST( get_valeur( trouver_table( table, 4 ) ) == 24, result );
+	liberer_table( table );
+
+	table = creer_intersection_table( table1, table2 );
+	TEST( taille_table( table ) == 1, result );
+	TEST( get_valeur( trouver_table( table, 3 ) ) == 13, result );
+	liberer_table( table );
+
+	table = creer_difference_table( table1, table2 );
+	TEST( taille_table( table ) == 2, result );
+	TEST( iterateur_est_vide( trouver_table( table, 3 ) ), result );
+	liberer_table( table );
+
+	union_dans_table( table2, table1 );
+	TEST( taille_table( table2 ) == 4, result );
+	TEST( get_valeur( trouver_table( table2, 3 ) ) == 23, result );
+	TEST( get_valeur( trouver_table( table2, 5 ) ) == 15, result );
+
+	intersection_dans_table( table1, table2 );
+	TEST( taille_table( table1 ) == 3, result );
+
+	liberer_table( table1 );
+	liberer_table( table2 );
+
+	return result;
+}
+
+intptr_t doubler_valeur( const intptr_t valeur ){
+	return 2*valeur;
+}
+
+int test_copier_table(){
+	int result = 1;
+
+	intptr_t cles[] = { -2, 3, 7, 8 };
+	intptr_t valeurs[] = { 12, 13, 17, 18 };
+
+	Table * table = creer_table_depuis_tableau_trie(
+		NULL, NULL, NULL, cles, valeurs, 4
+	);
+
+	TEST( taille_table( table ) == 4, result );
+	TEST( get_valeur( trouver_table( table, 7 ) ) == 17, result );
+	TEST( get_cle( premier_iterateur_table( table ) ) == -2, result );
+
+	Table * copie = copier_table( table, doubler_valeur );
+
+	TEST( taille_table( copie ) == 4, result );
+	TEST( get_valeur( trouver_table( copie, 7 ) ) == 34, result );
+	TEST( get_valeur( trouver_table( copie, -2 ) ) == 24, result );
+
+	liberer_table( table );
+	liberer_table( copie );
+
+	table = creer_table( 
+		(int (*)( const intptr_t, const intptr_t )) comparer_cle, 
+		(intptr_t (*)( const intptr_t )) copier_cle, 
+		(void (*)(intptr_t)) supprimer_cle 
+	);
+	Cle cle;
+	initialiser_cle( &cle, 1 ); 	
+	add_table( table, (intptr_t) &cle, 21);	
+	initialiser_cle( &cle, 2 ); 	
+	add_table( table, (intptr_t) &cle, 22);	
+
+	copie = copier_table( table, NULL );
+	liberer_table( table );
+
+	TEST( taille_table( copie ) == 2, result );
+	TEST( get_valeur( trouver_table( copie, (intptr_t) &cle ) ) == 22, result );
+
+	liberer_table( copie );
+
+	return result;
+}
+
+void compter_association( const intptr_t cle, intptr_t valeur, void* data ){
+	*(intptr_t*) data += valeur;
+}
+
+int test_creer_table_hachage(){
+	int result = 1;
+	int i;
+
+	Table * table = creer_table_hachage( NULL, NULL, NULL, NULL );
+
+	for( i=0; i<1000; i++ ) add_table( table, i, i+1 );
+	add_table( table, 5, -5 );
+
+	TEST( taille_table( table ) == 1000, result );
+	TEST( get_valeur( trouver_table( table, 5 ) ) == -5, result );
+	TEST( get_cle( trouver_table( table, 999 ) ) == 999, result );
+	TEST( iterateur_est_vide( trouver_table( table, 1000 ) ), result );
+
+	for( i=0; i<1000; i+=2 ){
+		intptr_t valeur = delete_table( table, i );
+		TEST( valeur == i+1, result );
+	}
+
+	TEST( taille_table( table ) == 500, result );
+	for( i=0; i<1000; i++ ){
+		TEST( iterateur_est_vide( trouver_table( table, i ) ) == ( i%2 == 0 ), result );
+	}
+
+	intptr_t somme = 0;
+	pour_toute_cle_valeur_table( table, compter_association, &somme );
+	TEST( somme == 250500 - 6 - 5, result );
+
+	Table * copie = copier_table( table, NULL );
+	vider_table( table );
+
+	TEST( taille_table( table ) == 0, result );
+	TEST( taille_table( copie ) == 500, result );
+	TEST( get_valeur( trouver_table( copie, 5 ) ) == -5, result );
+
+	liberer_table( table );
+	liberer_table( copie );
+
+	table = creer_table_hachage( 
+		(int (*)( const intptr_t, const intptr_t )) comparer_cle, 
+		(intptr_t (*)( const intptr_t )) copier_cle, 
+		(void (*)(intptr_t)) supprimer_cle,
+		(unsigned long (*)( const intptr_t )) hacher_cle
+	);
+
+	Cle cle;
+	for( i=0; i<100; i++ ){
+		initialiser_cle( &cle, i );
+		add_table( table, (intptr_t) &cle, i );
+	}
+	initialiser_cle( &cle, 42 ); 	
+	TEST( get_valeur( trouver_table( table, (intptr_t) &cle ) ) == 42, result );
+	TEST( get_cle( trouver_table( table, (intptr_t) &cle ) ) != (intptr_t) &cle, result );
+	delete_table( table, (intptr_t) &cle );
+	TEST( iterateur_est_vide( trouver_table( table, (intptr_t) &cle ) ), result );
+	TEST( taille_table( table ) == 99, result );
+
+	copie = copier_table( table, NULL );
+	liberer_table( table );
+	initialiser_cle( &cle, 43 ); 	
+	TEST( get_valeur( trouver_table( copie, (intptr_t) &cle ) ) == 43, result );
+	liberer_table( copie );
+
+	return result;
+}
+
+int test_curseur_table(){
+	int result = 1;
+	int i;
+
+	Table * table = creer_table( NULL, NULL, NULL );
+	Table_curseur curseur;
+
+	placer_curseur_table( &curseur, table );
+	TEST( curseur_table_est_vide( &curseur ), result );
+
+	for( i=10; i>0; i-- ) add_table( table, i, 2*i );
+
+	intptr_t precedente = 0;
+	int nb = 0;
+	int dans_l_ordre = 1;
+	for(
+		placer_curseur_table( &curseur, table );
+		! curseur_table_est_vide( &curseur );
+		avancer_curseur_table( &curseur )
+	){
+		intptr_t cle = cle_du_curseur_table( &curseur );
+		if( cle <= precedente ) dans_l_ordre = 0;
+		if( valeur_du_curseur_table( &curseur ) != 2*cle ) dans_l_ordre = 0;
+		precedente = cle;
+		nb++;
+	}
+	TEST( dans_l_ordre && nb == 10, result );
+	liberer_table( table );
+
+	table = creer_table_hachage( NULL, NULL, NULL, NULL );
+	placer_curseur_table( &curseur, table );
+	TEST( curseur_table_est_vide( &curseur ), result );
+
+	for( i=1; i<=100; i++ ) add_table( table, i, 2*i );
+	intptr_t somme = 0;
+	nb = 0;
+	for(
+		placer_curseur_table( &curseur, table );
+		! curseur_table_est_vide( &curseur );
+		avancer_curseur_table( &curseur )
+	){
+		somme += valeur_du_curseur_table( &curseur ) - cle_du_curseur_table( &curseur );
+		nb++;
+	}
+	TEST( nb == 100 && somme == 5050, result );
+	liberer_table( table );
+
+	return result;
+}
+
+/*
+ * Vérifie que la table contient exactement les clés i telles que present[i]
+ * est vrai, associées à la valeur 2*i, en la parcourant dans les deux sens.
+ */
+int verifier_table_cousue( Table* table, const char* present, int n ){
+	int i, nb = 0;
+	Table_iterateur it = premier_iterateur_table( table );
+	for( i=0; i<n; i++ ){
+		if( ! present[i] ) continue;
+		if( iterateur_est_vide( it ) ) return 0;
+		if( get_cle( it ) != i || get_valeur( it ) != 2*i ) return 0;
+		it = iterateur_suivant_table( it );
+		nb++;
+	}
+	if( ! iterateur_est_vide( it ) ) return 0;
+	if( taille_table( table ) != nb ) return 0;
+
+	// Depuis l'itérateur vide, l'itérateur précédent est le dernier.
+	it = iterateur_precedent_table( it );
+	for( i=n-1; i>=0; i-- ){
+		if( ! present[i] ) continue;
+		if( iterateur_est_vide( it ) ) return 0;
+		if( get_cle( it ) != i ) return 0;
+		it = iterateur_precedent_table( it );
+	}
+	return iterateur_est_vide( it );
+}
+
+int test_creer_table_cousue(){
+	int result = 1;
+	int i;
+	const int n = 200;
+	char present[200];
+
+	Table * table = creer_table_cousue( NULL, NULL, NULL );
+	TEST( taille_table( table ) == 0, result );
+	TEST( iterateur_est_vide( premier_iterateur_table( table ) ), result );
+
+	for( i=0; i<n; i++ ) present[i] = 0;
+	srand( 1 );
+	int ok = 1;
+	for( i=0; i<5000; i++ ){
+		int cle = rand() % n;
+		if( rand() % 3 ){
+			add_table( table, cle, 2*cle );
+			present[cle] = 1;
+		}else{
+			intptr_t valeur = delete_table( table, cle );
+			if( present[cle] && valeur != 2*cle ) ok = 0;
+			present[cle] = 0;
+		}
+		if( i % 50 == 0 && ! verifier_table_cousue( table, present, n ) ){
+			ok = 0;
+		}
+	}
+	TEST( ok, result );
+	TEST( verifier_table_cousue( table, present, n ), result );
+
+	for( i=0; i<n; i++ ){
+		Table_iterateur it = trouver_table( table, i );
+		if( iterateur_est_vide( it ) == present[i] ) ok = 0;
+	}
+	TEST( ok, result );
+
+	Table * copie = copier_table( table, NULL );
+	TEST( verifier_table_cousue( copie, present, n ), result );
+	liberer_table( copie );
+
+	// Les fusions conservent le type de la première table.
+	Table * autre = creer_table( NULL, NULL, NULL );
+	for( i=0; i<n; i+=2 ){
+		add_table( autre, i, 2*i );
+	}
+	Table * u = creer_union_table( table, autre );
+	for( i=0; i<n; i+=2 ) present[i] = 1;
+	TEST( verifier_table_cousue( u, present, n ), result );
+	for( i=0; i<n; i++ ){
+		if( present[i] ) delete_table( u, i );
+	}
+	TEST( taille_table( u ) == 0, result );
+	liberer_table( u );
+
+	union_dans_table( table, autre );
+	TEST( verifier_table_cousue( table, present, n ), result );
+	liberer_table( autre );
+
+	vider_table( table );
+	for( i=0; i<n; i++ ) present[i] = 0;
+	TEST( verifier_table_cousue( table, present, n ), result );
+	liberer_table( table );
+
+	table = creer_table_cousue( 
+		(int (*)( const intptr_t, const intptr_t )) comparer_cle, 
+		(intptr_t (*)( const intptr_t )) copier_cle, 
+		(void (*)(intptr_t)) supprimer_cle
+	);
+	Cle cle;
+	for( i=0; i<100; i++ ){
+		initialiser_cle( &cle, i );
+		add_table( table, (intptr_t) &cle, i );
+	}
+	initialiser_cle( &cle, 42 );
+	TEST( get_valeur( trouver_table( table, (intptr_t) &cle ) ) == 42, result );
+	delete_table( table, (intptr_t) &cle );
+	TEST( iterateur_est_vide( trouver_table( table, (intptr_t) &cle ) ), result );
+	TEST( taille_table( table ) == 99, result );
+	liberer_table( table );
+
+	return result;
+}
+
+int test_creer_table_arbre_b(){
+	int result = 1;
+	int i;
+	const int n = 3000;
+	char present[3000];
+
+	Table * table = creer_table_arbre_b( NULL, NULL, NULL );
+	TEST( taille_table( table ) == 0, result );
+	TEST( iterateur_est_vide( premier_iterateur_table( table ) ), result );
+	TEST( iterateur_est_vide( trouver_table( table, 0 ) ), result );
+
+	// Assez de clés pour que l'arbre ait plusieurs niveaux et que les 
+	// suppressions provoquent des emprunts et des fusions de noeuds.
+	for( i=0; i<n; i++ ) present[i] = 0;
+	srand( 2 );
+	int ok = 1;
+	for( i=0; i<40000; i++ ){
+		int cle = rand() % n;
+		if( ( i / 10000 ) % 2 == 0 ? rand() % 4 : rand() % 4 == 0 ){
+			add_table( table, cle, 2*cle );
+			present[cle] = 1;
+		}else{
+			intptr_t valeur = delete_table( table, cle );
+			if( present[cle] && valeur != 2*cle ) ok = 0;
+			present[cle] = 0;
+		}
+		if( i % 1000 == 0 && ! verifier_table_cousue( table, present, n ) ){
+			ok = 0;
+		}
+	}
+	TEST( ok, result );
+	TEST( verifier_table_cousue( table, present, n ), result );
+
+	for( i=0; i<n; i++ ){
+		Table_iterateur it = trouver_table( table, i );
+		if( iterateur_est_vide( it ) == present[i] ) ok = 0;
+		if( present[i] ){
+			// L'itérateur renvoyé par trouver_table() permet de continuer 
+			// le parcours.
+			int j = i+1;
+			while( j < n && ! present[j] ) j++;
+			it = iterateur_suivant_table( it );
+			if( j < n && ( iterateur_est_vide( it ) || get_cle( it ) != j ) ){
+				ok = 0;
+			}
+			if( j == n && ! iterateur_est_vide( it ) ) ok = 0;
+		}
+	}
+	TEST( ok, result );
+
+	Table * copie = copier_table( table, NULL );
+	TEST( verifier_table_cousue( copie, present, n ), result );
+	liberer_table( copie );
+
+	// Les fusions reconstruisent l'arbre en temps linéaire.
+	Table * autre = creer_table( NULL, NULL, NULL );
+	for( i=0; i<n; i+=2 ){
+		add_table( autre, i, 2*i );
+	}
+	Table * u = creer_union_table( table, autre );
+	for( i=0; i<n; i+=2 ) present[i] = 1;
+	TEST( verifier_table_cousue( u, present, n ), result );
+	for( i=0; i<n; i++ ){
+		if( present[i] ) delete_table( u, i );
+	}
+	TEST( taille_table( u ) == 0, result );
+	TEST( iterateur_est_vide( premier_iterateur_table( u ) ), result );
+	liberer_table( u );
+
+	union_dans_table( table, autre );
+	TEST( verifier_table_cousue( table, present, n ), result );
+	liberer_table( autre );
+
+	vider_table( table );
+	for( i=0; i<n; i++ ) present[i] = 0;
+	TEST( verifier_table_cousue( table, present, n ), result );
+	liberer_table( table );
+
+	table = creer_table_arbre_b( 
+		(int (*)( const intptr_t, const intptr_t )) comparer_cle, 
+		(intptr_t (*)( const intptr_t )) copier_cle, 
+		(void (*)(intptr_t)) supprimer_cle
+	);
+	Cle cle;
+	for( i=0; i<100; i++ ){
+		initialiser_cle( &cle, i );
+		add_table( table, (intptr_t) &cle, i );
+	}
+	initialiser_cle( &cle, 42 );
+	TEST( get_valeur( trouver_table( table, (intptr_t) &cle ) ) == 42, result );
+	delete_table( table, (intptr_t) &cle );
+	TEST( iterateur_est_vide( trouver_table( table, (intptr_t) &cle ) ), result );
+	TEST( taille_table( table ) == 99, result );
+	liberer_table( table );
+
+	return result;
+}
+
+/*
+ * Vérifie les bornes sur une table contenant les multiples de 3 de 0 à 2997.
+ */
+int verifier_bornes_table( Table* table ){
+	int k;
+	for( k=-1; k<=3001; k++ ){
+		intptr_t attendu = ( k <= 0 ) ? 0 : ( ( k + 2 ) / 3 ) * 3;
+		Table_iterateur it = premier_iterateur_superieur_ou_egal_table( table, k );
+		if( attendu >= 3000 ){
+			if( ! iterateur_est_vide( it ) ) return 0;
+		}else if( iterateur_est_vide( it ) || get_cle( it ) != attendu ){
+			return 0;
+		}
+
+		attendu = ( k < 0 ) ? 0 : ( k / 3 + 1 ) * 3;
+		it = premier_iterateur_superieur_table( table, k );
+		if( attendu >= 3000 ){
+			if( ! iterateur_est_vide( it ) ) return 0;
+		}else if( iterateur_est_vide( it ) || get_cle( it ) != attendu ){
+			return 0;
+		}
+	}
+
+	// Parcours de l'intervalle [100, 200[.
+	int nb = 0;
+	Table_curseur curseur = premier_iterateur_superieur_ou_egal_table( table, 100 );
+	while( ! curseur_table_est_vide( &curseur ) 
+		&& cle_du_curseur_table( &curseur ) < 200 
+	){
+		if( valeur_du_curseur_table( &curseur ) != 2 * cle_du_curseur_table( &curseur ) ){
+			return 0;
+		}
+		nb++;
+		avancer_curseur_table( &curseur );
+	}
+	return nb == 33;
+}
+
+int test_bornes_table(){
+	int result = 1;
+	int i, c;
+	Table* (*creer[3])(
+		int (*)( const intptr_t, const intptr_t ), 
+		intptr_t (*)( const intptr_t ), void (*)( intptr_t )
+	) = { creer_table, creer_table_cousue, creer_table_arbre_b };
+
+	for( c=0; c<3; c++ ){
+		Table * table = creer[c]( NULL, NULL, NULL );
+		TEST( iterateur_est_vide( premier_iterateur_superieur_ou_egal_table( table, 0 ) ), result );
+		for( i=2997; i>=0; i-=3 ){
+			add_table( table, i, 2*i );
+		}
+		TEST( verifier_bornes_table( table ), result );
+		liberer_table( table );
+	}
+
+	Table * table = creer_table( 
+		(int (*)( const intptr_t, const intptr_t )) comparer_cle, 
+		(intptr_t (*)( const intptr_t )) copier_cle, 
+		(void (*)(intptr_t)) supprimer_cle
+	);
+	Cle cle;
+	for( i=0; i<10; i++ ){
+		initialiser_cle( &cle, 10*i );
+		add_table( table, (intptr_t) &cle, i );
+	}
+	initialiser_cle( &cle, 35 );
+	Table_iterateur it = premier_iterateur_superieur_ou_egal_table( table, (intptr_t) &cle );
+	TEST( get_valeur( it ) == 4, result );
+	initialiser_cle( &cle, 40 );
+	it = premier_iterateur_superieur_table( table, (intptr_t) &cle );
+	TEST( get_valeur( it ) == 5, result );
+	liberer_table( table );
+
+	return result;
+}
+
+int nb_copies_cle = 0;
+
+Cle * copier_cle_compte( const Cle* cle ){
+	nb_copies_cle++;
+	return creer_cle( cle->cle );
+}
+
+int test_trouver_ou_ajouter_table(){
+	int result = 1;
+	int i, c;
+	Table* (*creer[3])(
+		int (*)( const intptr_t, const intptr_t ), 
+		intptr_t (*)( const intptr_t ), void (*)( intptr_t )
+	) = { creer_table, creer_table_cousue, creer_table_arbre_b };
+
+	for( c=0; c<4; c++ ){
+		int (*comparer)( const intptr_t, const intptr_t ) = 
+			(int (*)( const intptr_t, const intptr_t )) comparer_cle;
+		intptr_t (*copier)( const intptr_t ) = 
+			(intptr_t (*)( const intptr_t )) copier_cle_compte;
+		void (*supprimer)( intptr_t ) = (void (*)(intptr_t)) supprimer_cle;
+		Table * table = ( c < 3 ) ? 
+			creer[c]( comparer, copier, supprimer ) : 
+			creer_table_hachage( NULL, NULL, NULL, NULL );
+		Cle cle;
+		int nouvelle;
+		nb_copies_cle = 0;
+		int ok = 1;
+		for( i=0; i<300; i++ ){
+			initialiser_cle( &cle, i % 100 );
+			intptr_t clef = ( c < 3 ) ? (intptr_t) &cle : i % 100;
+			intptr_t * valeur = trouver_ou_ajouter_table( table, clef, &nouvelle );
+			if( nouvelle != ( i < 100 ) ) ok = 0;
+			if( nouvelle && *valeur != (intptr_t) NULL ) ok = 0;
+			*valeur += 1;
+		}
+		TEST( ok, result );
+		TEST( taille_table( table ) == 100, result );
+		// Les clés ne sont copiées que lors des ajouts.
+		TEST( c == 3 || nb_copies_cle == 100, result );
+		for( i=0; i<100; i++ ){
+			initialiser_cle( &cle, i );
+			intptr_t clef = ( c < 3 ) ? (intptr_t) &cle : i;
+			if( get_valeur( trouver_table( table, clef ) ) != 3 ) ok = 0;
+			const intptr_t * valeur = chercher_valeur_table( table, clef );
+			if( ! valeur || *valeur != 3 ) ok = 0;
+		}
+		TEST( ok, result );
+		initialiser_cle( &cle, 100 );
+		intptr_t absente = ( c < 3 ) ? (intptr_t) &cle : 100;
+		TEST( chercher_valeur_table( table, absente ) == NULL, result );
+		liberer_table( table );
+	}
+	return result;
+}
+
+int test_memoire_table(){
+	int result = 1;
+	int c, i;
+	for( c=0; c<4; c++ ){
+		Table * table;
+		if( c == 0 ) table = creer_table( NULL, NULL, NULL );
+		else if( c == 1 ) table = creer_table_cousue( NULL, NULL, NULL );
+		else if( c == 2 ) table = creer_table_arbre_b( NULL, NULL, NULL );
+		else table = creer_table_hachage( NULL, NULL, NULL, NULL );
+		size_t vide = memoire_table( table );
+		TEST( vide > 0, result );
+		for( i=0; i<1000; i++ ){
+			add_table( table, i, i );
+		}
+		size_t pleine = memoire_table( table );
+		// Chaque association occupe au moins une clé et une valeur.
+		TEST( pleine >= vide + 1000 * 2 * sizeof( intptr_t ), result );
+		liberer_table( table );
+	}
+	return result;
+}
+
+typedef struct {
+	int origine;
+	int lettre;
+} Paire;
+
+int comparer_paire( const Paire* a, const Paire* b ){
+	if( a->origine != b->origine ) return a->origine - b->origine;
+	return a->lettre - b->lettre;
+}
+
+int test_creer_table_cles_fixes(){
+	int result = 1;
+	int i;
+	int (*comparer)( const intptr_t, const intptr_t ) = 
+		(int (*)( const intptr_t, const intptr_t )) comparer_paire;
+
+	Table * table = creer_table_cles_fixes( sizeof(Paire), comparer );
+	Paire p;
+	for( i=0; i<100; i++ ){
+		p.origine = i % 10;
+		p.lettre = 'a' + i / 10;
+		add_table( table, (intptr_t) &p, i );
+	}
+	// La clé passée en paramètre a été recopiée : on peut la modifier.
+	p.origine = -1;
+	TEST( taille_table( table ) == 100, result );
+
+	int ok = 1;
+	for( i=0; i<100; i++ ){
+		Paire q = { i % 10, 'a' + i / 10 };
+		Table_iterateur it = trouver_table( table, (intptr_t) &q );
+		if( iterateur_est_vide( it ) || get_valeur( it ) != i ) ok = 0;
+		if( ! iterateur_est_vide( it ) && (intptr_t) &q == get_cle( it ) ) ok = 0;
+	}
+	TEST( ok, result );
+
+	// Les clés sont parcourues dans l'ordre ( origine, lettre ).
+	Paire precedente = { -1, 0 };
+	Table_curseur c;
+	for(
+		placer_curseur_table( &c, table );
+		! curseur_table_est_vide( &c );
+		avancer_curseur_table( &c )
+	){
+		const Paire * q = (const Paire*) cle_du_curseur_table( &c );
+		if( comparer_paire( &precedente, q ) >= 0 ) ok = 0;
+		precedente = *q;
+	}
+	TEST( ok, result );
+
+	Paire debut = { 3, 0 };
+	Table_iterateur it = premier_iterateur_superieur_ou_egal_table( 
+		table, (intptr_t) &debut 
+	);
+	TEST( ( (const Paire*) get_cle( it ) )->origine == 3, result );
+	TEST( ( (const Paire*) get_cle( it ) )->lettre == 'a', result );
+
+	Table * copie = copier_table( table, NULL );
+	Table * autre = creer_table_cles_fixes( sizeof(Paire), comparer );
+	p.origine = 100;
+	p.lettre = 'z';
+	add_table( autre, (intptr_t) &p, 1000 );
+	union_dans_table( copie, autre );
+	TEST( taille_table( copie ) == 101, result );
+	TEST( get_valeur( trouver_table( copie, (intptr_t) &p ) ) == 1000, result );
+	liberer_table( autre );
+
+	for( i=0; i<100; i++ ){
+		Paire q = { i % 10, 'a' + i / 10 };
+		if( delete_table( copie, (intptr_t) &q ) != i ) ok = 0;
+	}
+	TEST( ok, result );
+	TEST( taille_table( copie ) == 1, result );
+	liberer_table( copie );
+	TEST( taille_table( table ) == 100, result );
+	liberer_table( table );
+
+	return result;
+}
+
 int test_print_table(){
 	int result = 1;
 
@@ -388,6 +1074,8 @@ int test_trouver_table(){
 	TEST( get_cle( trouver_table( table, 3 ) ) == 3, result );
 	TEST( get_cle( trouver_table( table, 1 ) ) == 1, result );
 	TEST( get_valeur( trouver_table( table, 1 ) ) == -1, result );
+	TEST( *chercher_valeur_table( table, 3 ) == 3, result );
+	TEST( chercher_valeur_table( table, 2 ) == NULL, result );
 
 	liberer_table( table );
 
@@ -416,6 +1104,17 @@ int main(){
 	result &= test_add_table();
 	result &= test_delete_table();
 	result &= test_vider_table();
+	result &= test_taille_table();
+	result &= test_creer_union_table();
+	result &= test_copier_table();
+	result &= test_creer_table_hachage();
+	result &= test_curseur_table();
+	result &= test_creer_table_cousue();
+	result &= test_creer_table_arbre_b();
+	result &= test_bornes_table();
+	result &= test_trouver_ou_ajouter_table();
+	result &= test_memoire_table();
+	result &= test_creer_table_cles_fixes();
 	result &= test_print_table();
 	result &= test_pour_toute_valeur_table();
 	result &= test_pour_toute_cle_valeur_table();